@@ -9,6 +9,7 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -26,6 +27,8 @@ class RIoUring {
 private:
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
+   /// Number of read events submitted by SubmitReads() and not yet reaped by WaitRead()
+   std::uint32_t fNInFlight = 0;
 
 public:
    // Create an io_uring instance. The ring selects an appropriate queue depth. which can be queried
@@ -67,7 +70,14 @@ public:
    RIoUring& operator=(const RIoUring&) = delete;
 
    ~RIoUring() {
-      // todo(max) try submitting any pending events before exiting
+      // The kernel may still write into the buffers of in-flight events; drain them before tearing down the ring
+      while (fNInFlight > 0) {
+         struct io_uring_cqe *cqe;
+         if (io_uring_wait_cqe(&fRing, &cqe) < 0)
+            break;
+         io_uring_cqe_seen(&fRing, cqe);
+         fNInFlight--;
+      }
       io_uring_queue_exit(&fRing);
    }
 
@@ -92,11 +102,22 @@ public:
       std::size_t fOutBytes = 0;
       /// The file descriptor
       int fFileDes = -1;
+      /// Set by WaitRead() once the completion of an event submitted by SubmitReads() has been reaped
+      bool fIsDone = false;
+      /// Set by WaitRead() to the error code of a failed read
+      int fErrNo = 0;
    };
 
+   std::uint32_t GetNInFlight() const { return fNInFlight; }
+
    /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
+   /// the number of events is larger than the submission queue depth. Must not be mixed with
+   /// asynchronous reads submitted by SubmitReads() that are still in flight.
    void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
+      if (fNInFlight > 0) {
+         throw std::runtime_error("cannot submit blocking reads while " + std::to_string(fNInFlight)
+            + " asynchronous reads are in flight");
+      }
       unsigned int batch = 0;
       unsigned int batchSize = fDepth;
       unsigned int readPos = 0;
@@ -167,6 +188,72 @@ public:
       }
       return;
    }
+
+   /// Submit read events without waiting for their completion. At most as many events as there are free
+   /// slots in the ring are submitted; returns the number of submitted events, which are always the first
+   /// ones of the array. The events must stay valid until their completions are reaped by WaitRead().
+   unsigned int SubmitReads(RReadEvent *readEvents, unsigned int nReads) {
+      unsigned int nSubmit = std::min(nReads, fDepth - fNInFlight);
+      if (nSubmit == 0)
+         return 0;
+
+      struct io_uring_sqe *sqe;
+      for (unsigned int i = 0; i < nSubmit; ++i) {
+         if (readEvents[i].fFileDes == -1) {
+            throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(i) + "'");
+         }
+         if (readEvents[i].fBuffer == nullptr) {
+            throw std::runtime_error("null read buffer for read request '" + std::to_string(i) + "'");
+         }
+         sqe = io_uring_get_sqe(&fRing);
+         if (!sqe) {
+            throw std::runtime_error("get SQE failed for read request '" + std::to_string(i)
+               + "', error: " + std::string(strerror(errno)));
+         }
+         io_uring_prep_read(sqe,
+            readEvents[i].fFileDes,
+            readEvents[i].fBuffer,
+            readEvents[i].fSize,
+            readEvents[i].fOffset
+         );
+         sqe->flags |= IOSQE_ASYNC;
+         io_uring_sqe_set_data(sqe, &readEvents[i]);
+         readEvents[i].fIsDone = false;
+         readEvents[i].fErrNo = 0;
+      }
+
+      int submitted = io_uring_submit(&fRing);
+      if (submitted != static_cast<int>(nSubmit)) {
+         throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+            " events but requested " + std::to_string(nSubmit));
+      }
+      fNInFlight += nSubmit;
+      return nSubmit;
+   }
+
+   /// Block until any of the events submitted by SubmitReads() completes and return it. The completed
+   /// event may belong to a different batch than the caller's. Read errors are not thrown but recorded in
+   /// the event's fErrNo member.
+   RReadEvent *WaitRead() {
+      if (fNInFlight == 0) {
+         throw std::runtime_error("no asynchronous reads in flight");
+      }
+      struct io_uring_cqe *cqe;
+      int ret = io_uring_wait_cqe(&fRing, &cqe);
+      if (ret < 0) {
+         throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+      }
+      auto event = reinterpret_cast<RReadEvent *>(io_uring_cqe_get_data(cqe));
+      if (cqe->res < 0) {
+         event->fErrNo = -cqe->res;
+      } else {
+         event->fOutBytes = static_cast<std::size_t>(cqe->res);
+      }
+      event->fIsDone = true;
+      io_uring_cqe_seen(&fRing, cqe);
+      fNInFlight--;
+      return event;
+   }
 };
 
 } // namespace Internal
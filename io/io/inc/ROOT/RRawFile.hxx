@@ -87,6 +87,21 @@ public:
       }
    };
 
+   /// Returned by ReadVAsync() to track the completion of a vector read. The request vector and its buffers must stay
+   /// valid until Wait() returns. Destroying the handle implicitly waits for outstanding requests. Handles must not
+   /// outlive the RRawFile object that issued them.
+   class RReadVHandle {
+   public:
+      RReadVHandle() = default;
+      RReadVHandle(const RReadVHandle &) = delete;
+      RReadVHandle &operator=(const RReadVHandle &) = delete;
+      virtual ~RReadVHandle() = default;
+
+      /// Blocks until all requests of the vector read are served. On return, the fOutBytes members of the request
+      /// vector are set. The default handle represents an already finished read.
+      virtual void Wait() {}
+   };
+
 private:
    /// Don't change without adapting ReadAt()
    static constexpr unsigned int kNumBlockBuffers = 2;
@@ -120,6 +135,10 @@ private:
    bool fIsOpen = false;
    /// Runtime switch to decide if reads are buffered or directly sent to ReadAtImpl()
    bool fIsBuffering = true;
+   /// Set once MapImpl() has been called, so that a failed mapping attempt is not repeated
+   bool fIsMapTried = false;
+   /// The read-only mapping of the entire file, or nullptr if the file is not (yet) mapped
+   const void *fMappedBuffer = nullptr;
 
 protected:
    std::string fUrl;
@@ -139,6 +158,12 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default, the vector read is served synchronously by ReadVImpl() and an already finished handle is returned.
+   /// Implementations with native asynchronous I/O, e.g. io_uring, return as soon as the requests are submitted.
+   virtual std::unique_ptr<RReadVHandle> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Derived classes that can map files into memory return a read-only mapping of the first nbytes bytes of the file,
+   /// which must stay valid until the destruction of the object. The default implementation does not support mapping.
+   virtual const void *MapImpl(std::uint64_t /* nbytes */) { return nullptr; }
 
    /// Open the file if not already open. Otherwise noop.
    void EnsureOpen();
@@ -175,9 +200,17 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and calls ReadVAsyncImpl. The returned handle has to be waited for before the
+   /// buffers in the request vector are used.
+   std::unique_ptr<RReadVHandle> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
    /// Returns the limits regarding the ioVec input to ReadV for this specific file; may open the file as a side-effect.
    virtual RIOVecLimits GetReadVLimits() { return RIOVecLimits(); }
 
+   /// Opens the file if necessary and maps the entire file read-only into memory. Returns nullptr if the
+   /// implementation does not support memory mapping or if the mapping failed. The mapping stays valid until the
+   /// destruction of the RRawFile object; it is not shared by clones.
+   const void *Map();
+
    /// Turn off buffered reads; all scalar read requests go directly to the implementation. Buffering can be turned
    /// back on.
    void SetBuffering(bool value);
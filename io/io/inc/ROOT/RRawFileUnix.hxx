@@ -12,30 +12,54 @@
 #ifndef ROOT_RRawFileUnix
 #define ROOT_RRawFileUnix
 
+#include "RConfigure.h" // for R__HAS_URING
 #include <ROOT/RRawFile.hxx>
 #include <string_view>
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace ROOT {
 namespace Internal {
 
+class RIoUring;
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * If ROOT is built with io_uring support, vector reads are served by an io_uring instance that is created on the first
+ * vector read and kept for the lifetime of the file object. ReadVAsync() returns as soon as the requests are submitted.
+ *
+ * Map() uses mmap() to provide a read-only view of the entire file.
  */
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes = -1;
+   /// Set by MapImpl() and unmapped on destruction
+   void *fMapping = nullptr;
+   std::size_t fMappingSize = 0;
+#ifdef R__HAS_URING
+   /// Lazily created on the first vector read; null if io_uring is not available
+   std::unique_ptr<RIoUring> fIoUring;
+   /// Protects the io_uring instance, which is shared by all outstanding ReadVAsync() handles
+   std::mutex fIoUringLock;
+
+   /// Returns the io_uring instance, creating it if necessary, or nullptr if io_uring cannot be used
+   RIoUring *GetIoUring();
+#endif
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::unique_ptr<RReadVHandle> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
+   const void *MapImpl(std::uint64_t nbytes) final;
    std::uint64_t GetSizeImpl() final;
 
 public:
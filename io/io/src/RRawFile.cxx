@@ -103,6 +103,13 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+std::unique_ptr<ROOT::Internal::RRawFile::RReadVHandle>
+ROOT::Internal::RRawFile::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   ReadVImpl(ioVec, nReq);
+   return std::make_unique<RReadVHandle>();
+}
+
 std::string ROOT::Internal::RRawFile::GetLocation(std::string_view url)
 {
    auto idx = url.find(kTransportSeparator);
@@ -197,6 +204,27 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+std::unique_ptr<ROOT::Internal::RRawFile::RReadVHandle>
+ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   EnsureOpen();
+   return ReadVAsyncImpl(ioVec, nReq);
+}
+
+const void *ROOT::Internal::RRawFile::Map()
+{
+   if (fIsMapTried)
+      return fMappedBuffer;
+
+   EnsureOpen();
+   fIsMapTried = true;
+   const auto size = GetSize();
+   // Mapping an empty file is not possible
+   if (size > 0)
+      fMappedBuffer = MapImpl(size);
+   return fMappedBuffer;
+}
+
 void ROOT::Internal::RRawFile::SetBuffering(bool value)
 {
    fIsBuffering = value;
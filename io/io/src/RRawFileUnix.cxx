@@ -20,6 +20,7 @@
 
 #include <cerrno>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -27,17 +28,95 @@
 #include <vector>
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_URING
+/// Tracks a vector read submitted to the file's io_uring instance. Requests that do not fit into the ring on
+/// construction are submitted during Wait() as soon as slots are freed. Completions are reaped in any order, so
+/// waiting for one handle may also finish reads of other handles sharing the same ring.
+class RReadVHandleUring : public ROOT::Internal::RRawFile::RReadVHandle {
+private:
+   ROOT::Internal::RIoUring &fRing;
+   std::mutex &fLock;
+   ROOT::Internal::RRawFile::RIOVec *fIOVec;
+   std::vector<ROOT::Internal::RIoUring::RReadEvent> fEvents;
+   /// Number of events handed over to the ring
+   unsigned int fNSubmitted = 0;
+   /// All events before this index are known to be done
+   unsigned int fNChecked = 0;
+   bool fIsWaited = false;
+
+public:
+   RReadVHandleUring(ROOT::Internal::RIoUring &ring, std::mutex &lock, int fd, ROOT::Internal::RRawFile::RIOVec *ioVec,
+                     unsigned int nReq)
+      : fRing(ring), fLock(lock), fIOVec(ioVec), fEvents(nReq)
+   {
+      for (std::size_t i = 0; i < nReq; ++i) {
+         fEvents[i].fBuffer = ioVec[i].fBuffer;
+         fEvents[i].fOffset = ioVec[i].fOffset;
+         fEvents[i].fSize = ioVec[i].fSize;
+         fEvents[i].fFileDes = fd;
+      }
+      std::lock_guard<std::mutex> guard(fLock);
+      fNSubmitted = fRing.SubmitReads(fEvents.data(), nReq);
+   }
+
+   ~RReadVHandleUring() override
+   {
+      try {
+         Wait();
+      } catch (const std::runtime_error &e) {
+         Error("RRawFileUnix", "pending asynchronous vector read failed: %s", e.what());
+      }
+   }
+
+   void Wait() final
+   {
+      if (fIsWaited)
+         return;
+
+      const auto nEvents = static_cast<unsigned int>(fEvents.size());
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         while (fNChecked < nEvents) {
+            if (fNChecked < fNSubmitted && fEvents[fNChecked].fIsDone) {
+               fNChecked++;
+               continue;
+            }
+            if (fNSubmitted < nEvents)
+               fNSubmitted += fRing.SubmitReads(fEvents.data() + fNSubmitted, nEvents - fNSubmitted);
+            fRing.WaitRead();
+         }
+      }
+      fIsWaited = true;
+
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         if (fEvents[i].fErrNo != 0) {
+            throw std::runtime_error("read failed for ReadEvent[" + std::to_string(i) +
+                                     "], error: " + std::string(strerror(fEvents[i].fErrNo)));
+         }
+         fIOVec[i].fOutBytes = fEvents[i].fOutBytes;
+      }
+   }
+};
+#endif
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options) : RRawFile(url, options) {}
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+#ifdef R__HAS_URING
+   // The io_uring instance drains in-flight reads on destruction and thus needs the file descriptor open
+   fIoUring.reset();
+#endif
+   if (fMapping)
+      munmap(fMapping, fMappingSize);
    if (fFileDes >= 0)
       close(fFileDes);
 }
@@ -47,6 +126,19 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
    return std::make_unique<RRawFileUnix>(fUrl, fOptions);
 }
 
+const void *ROOT::Internal::RRawFileUnix::MapImpl(std::uint64_t nbytes)
+{
+   if (nbytes > std::numeric_limits<std::size_t>::max())
+      return nullptr;
+   void *mapping = mmap(nullptr, nbytes, PROT_READ, MAP_SHARED, fFileDes, 0);
+   // Not all files can be mapped, e.g. named pipes. The caller falls back to regular reads.
+   if (mapping == MAP_FAILED)
+      return nullptr;
+   fMapping = mapping;
+   fMappingSize = nbytes;
+   return fMapping;
+}
+
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
 {
 #ifdef R__SEEK64
@@ -92,36 +184,41 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
    }
 }
 
-void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
-{
 #ifdef R__HAS_URING
+ROOT::Internal::RIoUring *ROOT::Internal::RRawFileUnix::GetIoUring()
+{
    thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   std::lock_guard<std::mutex> guard(fIoUringLock);
+   if (!fIoUring && !uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
-         return;
-      }
-      catch(const std::runtime_error &e) {
+         fIoUring = std::make_unique<RIoUring>(); // throws std::runtime_error
+      } catch (const std::runtime_error &e) {
          Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
+         Warning("RRawFileUnix", "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
       }
    }
+   return fIoUring.get();
+}
+#endif
+
+std::unique_ptr<ROOT::Internal::RRawFile::RReadVHandle>
+ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   if (auto ring = GetIoUring())
+      return std::make_unique<RReadVHandleUring>(*ring, fIoUringLock, fFileDes, ioVec, nReq);
+#endif
+   return RRawFile::ReadVAsyncImpl(ioVec, nReq);
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   if (GetIoUring()) {
+      ReadVAsyncImpl(ioVec, nReq)->Wait();
+      return;
+   }
 #endif
    RRawFile::ReadVImpl(ioVec, nReq);
 }
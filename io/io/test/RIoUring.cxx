@@ -43,6 +43,75 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVAsync)
+{
+   auto file = "test_uring_readv_async";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   // Together, the outstanding requests exceed the ring size and are partially submitted while waiting
+   auto nReq = 1500;
+   auto iovecs1 = make_iovecs(nReq, filesize);
+   auto iovecs2 = make_iovecs(nReq, filesize);
+   auto handle1 = f->ReadVAsync(iovecs1.data(), nReq);
+   auto handle2 = f->ReadVAsync(iovecs2.data(), nReq);
+   handle2->Wait();
+   handle1->Wait();
+
+   for (auto iovecs : {iovecs1, iovecs2}) {
+      for (auto iovec : iovecs) {
+         EXPECT_GT(iovec.fOutBytes, 0U);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('a', ((unsigned char *)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
+TEST(RIoUring, SubmitReadsAsync)
+{
+   auto file = "test_uring_submit_async";
+   FileRaii fileGuard(file, "Hello, World");
+   RRawFileUnix f(file, RRawFile::ROptions());
+   // files are opened lazily, force file open via GetSize
+   f.GetSize();
+
+   RIoUring ring(2);
+   EXPECT_EQ(ring.GetQueueDepth(), 2);
+
+   char buffer[3] = {0, 0, 0};
+   RIoUring::RReadEvent events[3];
+   for (int i = 0; i < 3; ++i) {
+      events[i].fBuffer = &buffer[i];
+      events[i].fOffset = 7 + i;
+      events[i].fSize = 1;
+      events[i].fFileDes = f.GetFd();
+   }
+   // Only two events fit into the ring
+   EXPECT_EQ(2U, ring.SubmitReads(events, 3));
+   EXPECT_EQ(2U, ring.GetNInFlight());
+   EXPECT_EQ(0U, ring.SubmitReads(&events[2], 1));
+   EXPECT_THROW(ring.SubmitReadsAndWait(&events[2], 1), std::runtime_error);
+
+   ring.WaitRead();
+   EXPECT_EQ(1U, ring.SubmitReads(&events[2], 1));
+   ring.WaitRead();
+   ring.WaitRead();
+   EXPECT_EQ(0U, ring.GetNInFlight());
+   EXPECT_THROW(ring.WaitRead(), std::runtime_error);
+
+   for (int i = 0; i < 3; ++i) {
+      EXPECT_TRUE(events[i].fIsDone);
+      EXPECT_EQ(0, events[i].fErrNo);
+      EXPECT_EQ(1U, events[i].fOutBytes);
+   }
+   EXPECT_EQ('W', buffer[0]);
+   EXPECT_EQ('o', buffer[1]);
+   EXPECT_EQ('r', buffer[2]);
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
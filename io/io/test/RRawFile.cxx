@@ -148,6 +148,66 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create(readvGuard.GetPath());
+
+   char buffer[3];
+   buffer[0] = buffer[1] = buffer[2] = 0;
+   RRawFile::RIOVec iovec[3];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 11;
+   iovec[1].fSize = 2;
+   iovec[2].fBuffer = &buffer[2];
+   iovec[2].fOffset = 7;
+   iovec[2].fSize = 1;
+   auto handle1 = f->ReadVAsync(iovec, 2);
+   auto handle2 = f->ReadVAsync(&iovec[2], 1);
+   handle2->Wait();
+   handle1->Wait();
+
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ(1U, iovec[2].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('d', buffer[1]);
+   EXPECT_EQ('W', buffer[2]);
+
+   // Waiting twice is a noop
+   handle1->Wait();
+   EXPECT_EQ('H', buffer[0]);
+}
+
+
+TEST(RRawFile, Map)
+{
+   FileRaii mapGuard("test_rawfile_map", "Hello, World");
+   auto f = RRawFile::Create(mapGuard.GetPath());
+   auto mapping = static_cast<const char *>(f->Map());
+#ifdef _WIN32
+   EXPECT_EQ(nullptr, mapping);
+#else
+   ASSERT_NE(nullptr, mapping);
+   EXPECT_TRUE(f->IsOpen());
+   EXPECT_EQ(std::string("Hello, World"), std::string(mapping, 12));
+   // The mapping is created only once
+   EXPECT_EQ(mapping, f->Map());
+   // Clones don't share the mapping
+   EXPECT_NE(mapping, f->Clone()->Map());
+#endif
+
+   FileRaii emptyGuard("test_rawfile_map_empty", "");
+   EXPECT_EQ(nullptr, RRawFile::Create(emptyGuard.GetPath())->Map());
+
+   RRawFileMock m("abc", RRawFile::ROptions());
+   EXPECT_EQ(nullptr, m.Map());
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
@@ -24,6 +24,7 @@
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
@@ -46,6 +47,15 @@
 #include "TStatistic.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTupleFillContext.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
+#include "ROOT/RNTupleWriteOptions.hxx"
+#endif
 
 #include <algorithm>
 #include <functional>
@@ -344,6 +354,9 @@ public:
 template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    std::vector<HIST *> fObjects;
+   /// Per slot buffers of the selected values and weights of a bulk of entries, in bulk processing mode
+   std::vector<std::vector<double>> fBulkXs;
+   std::vector<std::vector<double>> fBulkWs;
 
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
@@ -457,7 +470,8 @@ public:
    FillHelper(FillHelper &&) = default;
    FillHelper(const FillHelper &) = delete;
 
-   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
+   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObjects(nSlots, nullptr), fBulkXs(nSlots), fBulkWs(nSlots)
    {
       fObjects[0] = h.get();
       // Initialize all other slots
@@ -511,6 +525,42 @@ public:
                     "columns passed did not match the signature of the object's `Fill` method.");
    }
 
+   // bulk processing mode, one-dimensional histograms with scalar values: fill all the selected entries at once
+   template <typename X, typename H = HIST,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_arithmetic<X>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const X *xs)
+   {
+      FillNBulk(slot, mask, xs, static_cast<const double *>(nullptr));
+   }
+
+   // bulk processing mode, one-dimensional histograms with scalar values and weights
+   template <typename X, typename W, typename H = HIST,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_arithmetic<X>::value &&
+                                 std::is_arithmetic<W>::value,
+                              int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, const X *xs, const W *ws)
+   {
+      FillNBulk(slot, mask, xs, ws);
+   }
+
+   template <typename X, typename W>
+   void FillNBulk(unsigned int slot, const RMaskedEntryRange &mask, const X *xs, const W *ws)
+   {
+      auto &bulkXs = fBulkXs[slot];
+      auto &bulkWs = fBulkWs[slot];
+      bulkXs.clear();
+      bulkWs.clear();
+      const auto bulkSize = mask.Size();
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         bulkXs.push_back(xs[i]);
+         if (ws)
+            bulkWs.push_back(ws[i]);
+      }
+      fObjects[slot]->FillN(bulkXs.size(), bulkXs.data(), ws ? bulkWs.data() : nullptr);
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -1338,6 +1388,9 @@ public:
    void Finalize() {}
 
    std::string GetActionName() { return "Display"; }
+
+   // Display may stop the event loop early and is not performance critical
+   bool SupportsBulk() const final { return false; }
 };
 
 template <typename T>
@@ -1634,6 +1687,9 @@ public:
 
    std::string GetActionName() { return "Snapshot"; }
 
+   // The output branches are bound to the addresses of the input values
+   bool SupportsBulk() const final { return false; }
+
    ROOT::RDF::SampleCallback_t GetSampleCallback() final
    {
       return [this](unsigned int, const RSampleInfo &) mutable { fBranchAddressesNeedReset = true; };
@@ -1820,6 +1876,9 @@ public:
 
    std::string GetActionName() { return "Snapshot"; }
 
+   // The output branches are bound to the addresses of the input values
+   bool SupportsBulk() const final { return false; }
+
    ROOT::RDF::SampleCallback_t GetSampleCallback() final
    {
       return [this](unsigned int slot, const RSampleInfo &) mutable { fBranchAddressesNeedReset[slot] = 1; };
@@ -1844,6 +1903,153 @@ public:
    }
 };
 
+#ifdef R__HAS_ROOT7
+/// Helper object for a Snapshot action that writes an RNTuple.
+/// Each processing slot fills its own RNTupleFillContext, which compresses and writes complete clusters
+/// independently of the other slots: unlike SnapshotHelperMT, there is no single merging thread that all the
+/// output data has to go through.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
+   using RNTupleFillContext = ROOT::Experimental::RNTupleFillContext;
+   using REntry = ROOT::Experimental::REntry;
+
+   unsigned int fNSlots;
+   std::string fFileName;            // name of the output file name
+   std::string fNTupleName;          // name of the output RNTuple
+   RSnapshotOptions fOptions;        // struct holding options to pass down to the RNTuple writer in this action
+   ColumnNames_t fInputFieldNames;   // This contains the resolved aliases
+   ColumnNames_t fOutputFieldNames;
+   std::function<void()> fOnWritten; // called once the output is complete, e.g. to read it with a new RDataFrame
+   std::unique_ptr<TFile> fOutputFile; // only used in "UPDATE" mode, to append the RNTuple to an existing file
+   std::unique_ptr<RNTupleParallelWriter> fWriter;
+   // The fill contexts must be destructed before the writer; they are created the first time a slot runs a task
+   std::vector<std::shared_ptr<RNTupleFillContext>> fFillContexts;
+   std::vector<std::unique_ptr<REntry>> fEntries;
+   std::vector<std::vector<REntry::RFieldToken>> fTokens;
+   bool fIsWritten = false;
+
+   template <std::size_t... S>
+   void AddFields(ROOT::Experimental::RNTupleModel &model, std::index_sequence<S...>)
+   {
+      // Fields are created from the type names rather than as RField<ColTypes>: this helper is instantiated for all
+      // Snapshot actions, also for column types that RNTuple does not support, which must only fail at runtime.
+      int expander[] = {(model.AddField(ROOT::Experimental::RFieldBase::Create(fOutputFieldNames[S],
+                                                                               TypeID2TypeName(typeid(ColTypes)))
+                                           .Unwrap()),
+                         0)...,
+                        0};
+      (void)expander; // avoid unused variable warnings
+      (void)model;
+   }
+
+   template <std::size_t... S>
+   void BindValues(unsigned int slot, ColTypes &...values, std::index_sequence<S...>)
+   {
+      // the type of the fields matches the type of the columns by construction, no need to check it for every entry
+      int expander[] = {(fEntries[slot]->template BindRawPtr<void>(fTokens[slot][S], &values), 0)..., 0};
+      (void)expander; // avoid unused variable warnings
+      (void)slot;
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &vfnames, const ColumnNames_t &fnames,
+                         const RSnapshotOptions &options, std::function<void()> onWritten)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options), fInputFieldNames(vfnames),
+        fOutputFieldNames(ReplaceDotWithUnderscore(fnames)), fOnWritten(std::move(onWritten)),
+        fFillContexts(fNSlots), fEntries(fNSlots), fTokens(fNSlots)
+   {
+      if (!dirname.empty())
+         throw std::invalid_argument("Snapshot: writing an RNTuple into a TFile subdirectory is not supported");
+      ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && fOptions.fLazy && !fIsWritten /* never run */)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::CreateBare();
+      AddFields(*model, std::index_sequence_for<ColTypes...>());
+
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+
+      TString fileMode = fOptions.fMode;
+      fileMode.ToLower();
+      if (fileMode == "update") {
+         ::TDirectory::TContext c; // do not let the output file become the current directory
+         fOutputFile.reset(TFile::Open(fFileName.c_str(), "UPDATE"));
+         if (!fOutputFile || fOutputFile->IsZombie())
+            throw std::runtime_error("Snapshot: could not open output file " + fFileName);
+         fWriter = RNTupleParallelWriter::Append(std::move(model), fNTupleName, *fOutputFile, writeOptions);
+      } else {
+         fWriter = RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName, writeOptions);
+      }
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (fFillContexts[slot])
+         return;
+      // first time this slot executes something: the fill context is kept for the whole event loop, so that its
+      // clusters are not cut at task boundaries
+      fFillContexts[slot] = fWriter->CreateFillContext();
+      fEntries[slot] = fFillContexts[slot]->CreateEntry();
+      for (const auto &name : fOutputFieldNames)
+         fTokens[slot].emplace_back(fEntries[slot]->GetToken(name));
+   }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      BindValues(slot, values..., std::index_sequence_for<ColTypes...>());
+      fFillContexts[slot]->Fill(*fEntries[slot]);
+   }
+
+   void Finalize()
+   {
+      // committing the remaining clusters of each fill context only requires a short critical section in the writer
+      fEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+      if (fOutputFile) {
+         fOutputFile->Close();
+         fOutputFile.reset();
+      }
+      fIsWritten = true;
+      if (fOnWritten)
+         fOnWritten();
+      fOnWritten = nullptr;
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   // The output fields are bound to the addresses of the input values
+   bool SupportsBulk() const final { return false; }
+
+   /**
+    * @brief Create a new SnapshotRNTupleHelper with a different output file name
+    *
+    * @param newName A type-erased string with the output file name
+    * @return SnapshotRNTupleHelper
+    *
+    * See SnapshotHelperMT::MakeNew. The RDataFrame returned by the original Snapshot does not read the new file.
+    */
+   SnapshotRNTupleHelper MakeNew(void *newName)
+   {
+      const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+      return SnapshotRNTupleHelper{fNSlots, finalName, "", fNTupleName, fInputFieldNames, fOutputFieldNames, fOptions,
+                                   nullptr};
+   }
+};
+#endif // R__HAS_ROOT7
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
@@ -23,6 +23,8 @@
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -38,6 +40,19 @@ std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node, co
                                              std::unordered_map<void *, std::shared_ptr<GraphNode>> &visitedMap);
 } // namespace GraphDrawing
 
+/// Detect whether the action helper implements `ExecBulk(slot, mask, const ColTypes *...)`, which processes all the
+/// selected entries of a bulk in one call.
+template <typename Helper, typename ColumnTypes_t, typename = void>
+struct HasExecBulk : std::false_type {
+};
+
+template <typename Helper, typename... ColTypes>
+struct HasExecBulk<Helper, TypeList<ColTypes...>,
+                   std::void_t<decltype(std::declval<Helper &>().ExecBulk(
+                      0u, std::declval<const RMaskedEntryRange &>(), std::declval<const ColTypes *>()...))>>
+   : std::true_type {
+};
+
 // clang-format off
 /**
  * \class ROOT::Internal::RDF::RAction
@@ -112,6 +127,31 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const RMaskedEntryRange &mask, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(mask)...};
+      if constexpr (HasExecBulk<Helper, ColumnTypes_t>::value) {
+         fHelper.ExecBulk(slot, mask, std::get<S>(values)...);
+      } else {
+         const auto bulkSize = mask.Size();
+         for (std::size_t i = 0; i < bulkSize; ++i) {
+            if (mask[i])
+               fHelper.Exec(slot, std::get<S>(values)[i]...);
+         }
+      }
+      (void)values; // avoid unused variable warning for actions without input columns
+   }
+
+   bool SupportsBulk() const final { return fHelper.SupportsBulk(); }
+
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      const auto &mask = fPrevNode.CheckFiltersBulk(slot, firstEntry, bulkSize);
+      if (mask.Count() > 0)
+         CallExecBulk(slot, mask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
@@ -129,6 +169,8 @@ public:
       SetHasRun();
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final
    {
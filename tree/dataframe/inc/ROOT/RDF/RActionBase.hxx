@@ -16,7 +16,9 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 namespace ROOT {
@@ -34,6 +36,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RResultCacheIOBase;
 
 using namespace ROOT::Detail::RDF;
 
@@ -42,6 +45,11 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   /// Access to the result of this action for the on-disk result cache, null if the result type is not supported.
+   std::unique_ptr<RResultCacheIOBase> fResultCacheIO;
+   /// True if the action calls user-provided code, e.g. a custom helper, whose content cannot be part of the key of
+   /// the result cache.
+   bool fRunsUserCode = false;
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -63,7 +71,18 @@ public:
    RColumnRegister &GetColRegister() { return fColRegister; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
+   void SetResultCacheIO(std::unique_ptr<RResultCacheIOBase> io);
+   RResultCacheIOBase *GetResultCacheIO() const { return fResultCacheIO.get(); }
+   void SetRunsUserCode() { fRunsUserCode = true; }
+   bool RunsUserCode() const { return fRunsUserCode; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Return true if the action can process a bulk of entries at a time, see RunBulk()
+   virtual bool SupportsBulk() const { return false; }
+   /// Run the action on the entries of the bulk [firstEntry, firstEntry + bulkSize) that pass all upstream filters
+   virtual void RunBulk(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*bulkSize*/)
+   {
+      throw std::logic_error("This action does not support bulk processing.");
+   }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -72,6 +91,8 @@ public:
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    virtual void *PartialUpdate(unsigned int slot) = 0;
+   /// Return the name of the action, as shown in diagnostics and in the computation graph
+   virtual std::string GetActionName() = 0;
 
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
@@ -71,6 +71,10 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return false if the helper cannot be used in bulk processing mode, e.g. because it relies
+   /// on the input values being at the same addresses in all Exec() calls.
+   virtual bool SupportsBulk() const { return true; }
 };
 
 } // namespace RDF
@@ -0,0 +1,452 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCACHEDS
+#define ROOT_RDF_RCACHEDS
+
+#include "ROOT/RDataSource.hxx"
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/RDF/Utils.hxx" // IsDataContainer, TypeID2TypeName
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/TSeq.hxx"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility> // std::index_sequence
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+void SetCacheMemoryBudget(std::size_t maxBytes, std::string_view spillDirectory);
+std::size_t GetCacheMemoryBudget();
+const std::string &GetCacheSpillDirectory();
+
+/**
+\class ROOT::Internal::RDF::RCacheSpillFile
+\ingroup dataframe
+\brief The entries of a cached dataset that a processing slot moved from memory to an RNTuple in a temporary file.
+
+While the dataset is filled, the values of the columns that RNTuple can store are appended to the file whenever the
+slot exceeds its share of the memory budget. They are read back lazily, one entry at a time and only for the columns
+that are actually used, by a reader per processing slot. The file is removed when the object is destroyed.
+**/
+class RCacheSpillFile {
+   struct RWriter;
+   struct RSlotReader;
+
+   std::string fFileName;
+   /// The type of the values of each column, empty for the columns that are not stored in the file
+   std::vector<std::string> fTypeNames;
+   std::unique_ptr<RWriter> fWriter;
+   std::vector<std::unique_ptr<RSlotReader>> fSlotReaders;
+   ULong64_t fNEntries = 0;
+
+   RCacheSpillFile(const std::string &fileName, const std::vector<std::string> &typeNames);
+
+public:
+   /// Return whether the values of a type can be moved to a spill file.
+   static bool CanStore(const std::string &typeName);
+   /// Create a temporary file in the directory (the system default if empty) for the columns of the given types, empty
+   /// for the columns that stay in memory. The writer buffers at most about maxBufferBytes before writing a cluster.
+   /// Return null if the file cannot be created: the values should then stay in memory.
+   static std::unique_ptr<RCacheSpillFile>
+   Create(const std::string &directory, const std::vector<std::string> &typeNames, std::size_t maxBufferBytes);
+   ~RCacheSpillFile();
+   RCacheSpillFile(const RCacheSpillFile &) = delete;
+   RCacheSpillFile &operator=(const RCacheSpillFile &) = delete;
+
+   bool HasColumn(std::size_t column) const { return !fTypeNames[column].empty(); }
+   ULong64_t GetNEntries() const { return fNEntries; }
+   /// Append an entry, given the address of the value of each column. Those of the columns that are not stored are
+   /// ignored.
+   void Fill(const std::vector<void *> &valuePtrs);
+   /// Write the buffered entries and close the writer: no entry can be appended afterwards, but they can be loaded.
+   void CommitWrite();
+
+   /// Set the address that Load() reads the values of a column into for the given slot.
+   void BindSlot(unsigned int slot, std::size_t column, void *valuePtr);
+   void Load(unsigned int slot, std::size_t column, ULong64_t entry);
+};
+
+/// Return the number of bytes used by a cached value, including the elements of collections.
+template <typename T>
+std::size_t GetCachedValueBytes(const T &value)
+{
+   if constexpr (IsDataContainer<T>::value && !std::is_same<T, std::vector<bool>>::value)
+      return sizeof(T) + value.size() * sizeof(typename T::value_type);
+   else
+      return sizeof(value);
+}
+
+/// The values of the columns of a cached dataset, as filled by RCacheHelper.
+template <typename... ColumnTypes>
+struct RCachedColumns {
+   /// Per processing slot of the event loop that filled them: the values still in memory, column by column. For the
+   /// columns stored in the spill file of the slot, they follow the values in the file.
+   std::vector<std::tuple<std::vector<ColumnTypes>...>> fValues;
+   /// Per processing slot: the number of entries it cached
+   std::vector<ULong64_t> fNEntries;
+   /// Per processing slot: the file of the entries it moved out of memory, null if none
+   std::vector<std::unique_ptr<RCacheSpillFile>> fSpillFiles;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief The action that fills the columns of the dataset returned by RInterface::Cache.
+///
+/// Each processing slot buffers the values of its entries. With a memory budget (see
+/// ROOT::RDF::Experimental::SetCacheMemoryBudget), a slot that exceeds its share of the budget appends the values of
+/// the columns that RNTuple can store to its own temporary file and releases their memory, so that the cached columns
+/// never hold much more than the budget, also while they are filled.
+template <typename... ColumnTypes>
+class RCacheHelper : public ROOT::Detail::RDF::RActionImpl<RCacheHelper<ColumnTypes...>> {
+public:
+   using Result_t = RCachedColumns<ColumnTypes...>;
+
+private:
+   std::shared_ptr<Result_t> fResult;
+   unsigned int fNSlots;
+   /// The number of bytes each slot can keep in memory, 0 if there is no limit
+   std::size_t fSlotBudget;
+   std::string fSpillDirectory;
+   /// The type of the values of each column if they can be spilled, an empty string otherwise
+   std::vector<std::string> fSpillTypeNames;
+   /// Per slot: the bytes of the values in memory that the slot can spill, and of those it cannot
+   std::vector<std::size_t> fSpillableBytes;
+   std::vector<std::size_t> fPinnedBytes;
+   /// Per slot: whether creating the spill file failed, in which case the values stay in memory
+   std::vector<bool> fSpillFailed;
+
+   template <typename T>
+   static std::string GetSpillTypeName()
+   {
+      // the values of a std::vector<bool> are not addressable
+      if constexpr (std::is_same<T, bool>::value)
+         return "";
+      else {
+         const auto typeName = TypeID2TypeName(typeid(T));
+         return RCacheSpillFile::CanStore(typeName) ? typeName : "";
+      }
+   }
+
+   template <typename T>
+   static void *GetValuePtr(std::vector<T> &values, ULong64_t i)
+   {
+      if constexpr (std::is_same<T, bool>::value)
+         return nullptr; // never spilled
+      else
+         return &values[i];
+   }
+
+   template <std::size_t... S>
+   void PushBack(unsigned int slot, std::index_sequence<S...>, const ColumnTypes &...values)
+   {
+      auto &slotValues = fResult->fValues[slot];
+      int expander[] = {(std::get<S>(slotValues).push_back(values), 0)..., 0};
+      (void)expander; // avoid unused variable warnings
+      if (fSlotBudget == 0)
+         return;
+      const std::size_t bytes[] = {GetCachedValueBytes(values)..., 0};
+      for (std::size_t column = 0; column < sizeof...(ColumnTypes); ++column)
+         (fSpillTypeNames[column].empty() ? fPinnedBytes[slot] : fSpillableBytes[slot]) += bytes[column];
+   }
+
+   /// Append the values of the slot that can be spilled to its file and release their memory.
+   template <std::size_t... S>
+   void Spill(unsigned int slot, std::index_sequence<S...>)
+   {
+      auto &spillFile = fResult->fSpillFiles[slot];
+      if (!spillFile) {
+         if (fSpillFailed[slot])
+            return;
+         spillFile = RCacheSpillFile::Create(fSpillDirectory, fSpillTypeNames, fSlotBudget);
+         if (!spillFile) {
+            fSpillFailed[slot] = true;
+            return;
+         }
+      }
+
+      auto &slotValues = fResult->fValues[slot];
+      const auto nBuffered = fResult->fNEntries[slot] - spillFile->GetNEntries();
+      std::vector<void *> valuePtrs(sizeof...(ColumnTypes), nullptr);
+      for (ULong64_t i = 0; i < nBuffered; ++i) {
+         int expander[] = {(valuePtrs[S] = GetValuePtr(std::get<S>(slotValues), i), 0)..., 0};
+         (void)expander; // avoid unused variable warnings
+         spillFile->Fill(valuePtrs);
+      }
+      int expander[] = {(spillFile->HasColumn(S) ? (std::get<S>(slotValues).clear(), 0) : 0)..., 0};
+      (void)expander;
+      fSpillableBytes[slot] = 0;
+   }
+
+public:
+   RCacheHelper(unsigned int nSlots, std::size_t memoryBudget, const std::string &spillDirectory)
+      : fResult(std::make_shared<Result_t>()),
+        fNSlots(nSlots),
+        fSlotBudget(memoryBudget == 0 ? 0 : std::max<std::size_t>(memoryBudget / nSlots, 1)),
+        fSpillDirectory(spillDirectory)
+   {
+      if (fSlotBudget > 0)
+         fSpillTypeNames = {GetSpillTypeName<ColumnTypes>()...};
+   }
+   RCacheHelper(RCacheHelper &&) = default;
+   RCacheHelper(const RCacheHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize()
+   {
+      fResult->fValues.assign(fNSlots, {});
+      fResult->fNEntries.assign(fNSlots, 0);
+      fResult->fSpillFiles.clear();
+      fResult->fSpillFiles.resize(fNSlots);
+      fSpillableBytes.assign(fNSlots, 0);
+      fPinnedBytes.assign(fNSlots, 0);
+      fSpillFailed.assign(fNSlots, false);
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColumnTypes &...values)
+   {
+      PushBack(slot, std::index_sequence_for<ColumnTypes...>(), values...);
+      ++fResult->fNEntries[slot];
+      if (fSlotBudget > 0 && fSpillableBytes[slot] > 0 && fSpillableBytes[slot] + fPinnedBytes[slot] > fSlotBudget)
+         Spill(slot, std::index_sequence_for<ColumnTypes...>());
+   }
+
+   void Finalize()
+   {
+      for (auto &spillFile : fResult->fSpillFiles) {
+         if (spillFile)
+            spillFile->CommitWrite();
+      }
+   }
+
+   std::string GetActionName() { return "Cache"; }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief The data source of the RDataFrame returned by RInterface::Cache.
+///
+/// The columns are filled by an RCacheHelper action of the original computation graph, which runs the first time the
+/// cached dataset is processed. The entries are those of the processing slots of that event loop, one slot after the
+/// other. Those that a slot moved to its spill file to respect the cache memory budget are read back lazily, entry by
+/// entry, only for the columns that are used.
+template <typename... ColumnTypes>
+class RCacheDS final : public ROOT::RDF::RDataSource {
+   using PointerHolderPtrs_t = std::vector<ROOT::Internal::TDS::TPointerHolder *>;
+
+   RResultPtr<RCachedColumns<ColumnTypes...>> fColumns;
+   const std::vector<std::string> fColNames;
+   const std::map<std::string, std::string> fColTypesMap;
+   // Initialized with the pack of arguments of the constructor, then copied for each slot in SetNSlots()
+   const PointerHolderPtrs_t fPointerHoldersModels;
+   std::vector<PointerHolderPtrs_t> fPointerHolders;
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges{};
+   unsigned int fNSlots{0};
+   ULong64_t fNEntries{0};
+   bool fIsFilled = false;
+   /// The nth flag signals whether the nth column is read by the computation graph
+   std::vector<bool> fIsRead;
+   /// The first entry of each processing slot of the event loop that filled the columns, followed by the number of
+   /// entries
+   std::vector<ULong64_t> fFirstEntries;
+
+   template <std::size_t... S>
+   static std::map<std::string, std::string>
+   MakeColTypesMap(const std::vector<std::string> &colNames, std::index_sequence<S...>)
+   {
+      return {{colNames[S], TypeID2TypeName(typeid(ColumnTypes))}...};
+   }
+
+   Record_t GetColumnReadersImpl(std::string_view colName, const std::type_info &id) final
+   {
+      auto colNameStr = std::string(colName);
+      const auto idName = TypeID2TypeName(id);
+      auto it = fColTypesMap.find(colNameStr);
+      if (fColTypesMap.end() == it) {
+         std::string err = "The specified column name, \"" + colNameStr + "\" is not known to the data source.";
+         throw std::runtime_error(err);
+      }
+
+      const auto colIdName = it->second;
+      if (colIdName != idName) {
+         std::string err = "Column " + colNameStr + " has type " + colIdName +
+                           " while the id specified is associated to type " + idName;
+         throw std::runtime_error(err);
+      }
+
+      const auto index = std::distance(fColNames.begin(), std::find(fColNames.begin(), fColNames.end(), colName));
+      fIsRead[index] = true;
+
+      Record_t ret(fNSlots);
+      for (auto slot : ROOT::TSeqU(fNSlots)) {
+         ret[slot] = fPointerHolders[index][slot]->GetPointerAddr();
+      }
+      return ret;
+   }
+
+   template <std::size_t S>
+   void SetColumnEntry(unsigned int slot, std::size_t fillSlot, ULong64_t fillEntry)
+   {
+      using T = std::tuple_element_t<S, std::tuple<ColumnTypes...>>;
+      if (!fIsRead[S])
+         return;
+      auto &spillFile = fColumns->fSpillFiles[fillSlot];
+      ULong64_t nSpilled = 0;
+      if (spillFile && spillFile->HasColumn(S)) {
+         nSpilled = spillFile->GetNEntries();
+         if (fillEntry < nSpilled) {
+            spillFile->Load(slot, S, fillEntry);
+            return;
+         }
+      }
+      *static_cast<T *>(fPointerHolders[S][slot]->GetPointer()) =
+         std::get<S>(fColumns->fValues[fillSlot])[fillEntry - nSpilled];
+   }
+
+   template <std::size_t... S>
+   void SetEntryHelper(unsigned int slot, ULong64_t entry, std::index_sequence<S...>)
+   {
+      // find the processing slot that filled the entry
+      const auto next = std::upper_bound(fFirstEntries.begin(), fFirstEntries.end(), entry);
+      const std::size_t fillSlot = next - fFirstEntries.begin() - 1;
+      const auto fillEntry = entry - fFirstEntries[fillSlot];
+      int expander[] = {(SetColumnEntry<S>(slot, fillSlot, fillEntry), 0)..., 0};
+      (void)expander; // avoid unused variable warnings
+   }
+
+public:
+   RCacheDS(RResultPtr<RCachedColumns<ColumnTypes...>> columns, const std::vector<std::string> &colNames)
+      : fColumns(std::move(columns)),
+        fColNames(colNames),
+        fColTypesMap(MakeColTypesMap(colNames, std::index_sequence_for<ColumnTypes...>())),
+        fPointerHoldersModels({new ROOT::Internal::TDS::TTypedPointerHolder<ColumnTypes>(new ColumnTypes())...}),
+        fIsRead(sizeof...(ColumnTypes), false)
+   {
+   }
+
+   ~RCacheDS()
+   {
+      // the readers of the spill files are bound to the values of the pointer holders; this also removes the files
+      if (fIsFilled)
+         fColumns->fSpillFiles.clear();
+      for (auto &&ptrHolderv : fPointerHolders) {
+         for (auto &&ptrHolder : ptrHolderv) {
+            delete ptrHolder;
+         }
+      }
+   }
+
+   const std::vector<std::string> &GetColumnNames() const final { return fColNames; }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final
+   {
+      auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+      return entryRanges;
+   }
+
+   std::string GetTypeName(std::string_view colName) const final
+   {
+      const auto key = std::string(colName);
+      return fColTypesMap.at(key);
+   }
+
+   bool HasColumn(std::string_view colName) const final
+   {
+      const auto key = std::string(colName);
+      const auto endIt = fColTypesMap.end();
+      return endIt != fColTypesMap.find(key);
+   }
+
+   bool SetEntry(unsigned int slot, ULong64_t entry) final
+   {
+      SetEntryHelper(slot, entry, std::index_sequence_for<ColumnTypes...>());
+      return true;
+   }
+
+   void SetNSlots(unsigned int nSlots) final
+   {
+      fNSlots = nSlots;
+      const auto nCols = fColNames.size();
+      fPointerHolders.resize(nCols); // now we need to fill it with the slots, all of the same type
+      auto colIndex = 0U;
+      for (auto &&ptrHolderv : fPointerHolders) {
+         for (auto slot : ROOT::TSeqI(fNSlots)) {
+            auto ptrHolder = fPointerHoldersModels[colIndex]->GetDeepCopy();
+            ptrHolderv.emplace_back(ptrHolder);
+            (void)slot;
+         }
+         colIndex++;
+      }
+      for (auto &&ptrHolder : fPointerHoldersModels)
+         delete ptrHolder;
+   }
+
+   void Initialize() final
+   {
+      if (!fIsFilled) {
+         // the first access to the columns runs the event loop of the original computation graph
+         auto &columns = *fColumns;
+         fFirstEntries.assign(1, 0);
+         for (auto nEntries : columns.fNEntries)
+            fFirstEntries.push_back(fFirstEntries.back() + nEntries);
+         fNEntries = fFirstEntries.back();
+         for (auto &spillFile : columns.fSpillFiles) {
+            if (!spillFile)
+               continue;
+            for (std::size_t column = 0; column < fColNames.size(); ++column) {
+               for (auto slot : ROOT::TSeqU(fNSlots)) {
+                  if (spillFile->HasColumn(column))
+                     spillFile->BindSlot(slot, column, fPointerHolders[column][slot]->GetPointer());
+               }
+            }
+         }
+         fIsFilled = true;
+      }
+
+      const auto nEntriesInRange = fNEntries / fNSlots; // between integers. Should make smaller?
+      auto reminder = 1U == fNSlots ? 0 : fNEntries % fNSlots;
+      fEntryRanges.resize(fNSlots);
+      auto init = 0ULL;
+      auto end = 0ULL;
+      for (auto &&range : fEntryRanges) {
+         end = init + nEntriesInRange;
+         if (0 != reminder) { // Distribute the reminder among the first chunks
+            reminder--;
+            end += 1;
+         }
+         range.first = init;
+         range.second = end;
+         init = end;
+      }
+   }
+
+   std::string GetLabel() final { return "Cache"; }
+
+protected:
+   std::string AsString() final { return "cached data source"; };
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RCACHEDS
@@ -13,7 +13,15 @@
 
 #include <Rtypes.h>
 
+#include <cstddef> // std::size_t
+
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RMaskedEntryRange;
+}
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -38,8 +46,30 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return the address of the column values of a bulk of entries, in bulk processing mode.
+   /// The values are contiguous in memory, one per entry of the bulk; only the values of the entries selected by the
+   /// mask are guaranteed to be valid.
+   /// \tparam T The column type
+   /// \param mask The bulk of entries and the selected entries
+   template <typename T>
+   T *GetBulk(const ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      return static_cast<T *>(GetBulkImpl(mask));
+   }
+
+   /// Return true if the reader can copy the values of the dataset entries into a bulk, see StageBulkEntry().
+   /// Only readers of dataset columns need to support staging.
+   virtual bool CanStageBulk() const { return false; }
+
+   /// Copy the value of the dataset entry that is currently loaded to position `idx` of the bulk buffer.
+   /// \param entry The entry number
+   /// \param idx The position of the entry in the bulk
+   /// \param bulkSize The maximum number of entries in a bulk
+   virtual void StageBulkEntry(Long64_t /*entry*/, std::size_t /*idx*/, std::size_t /*bulkSize*/) {}
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange &) { return nullptr; }
 };
 
 } // namespace RDF
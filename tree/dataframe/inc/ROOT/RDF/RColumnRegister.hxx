@@ -118,6 +118,8 @@ public:
 
    std::vector<std::string> GetVariationsFor(const std::string &column) const;
 
+   std::vector<RVariationBase *> GetVariationNodesFor(const std::string &column) const;
+
    std::vector<std::string> GetVariationDeps(const std::string &column) const;
 
    std::vector<std::string> GetVariationDeps(const std::vector<std::string> &columns) const;
@@ -12,8 +12,13 @@
 #define ROOT_RDF_RDSCOLUMNREADER
 
 #include "RColumnReaderBase.hxx"
+#include "RMaskedEntryRange.hxx"
+#include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 
+#include <cstddef> // std::size_t
+#include <type_traits>
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -23,10 +28,26 @@ template <typename T>
 class R__CLING_PTRCHECK(off) RDSColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    T **fDSValuePtr = nullptr;
 
+   static constexpr bool kCanStageBulk = std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value;
+   /// Copies of the values of the current bulk of entries, in bulk processing mode
+   ROOT::RVec<T> fBulkValues;
+
    void *GetImpl(Long64_t) final { return *fDSValuePtr; }
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.data(); }
 
 public:
    RDSColumnReader(void *DSValuePtr) : fDSValuePtr(static_cast<T **>(DSValuePtr)) {}
+
+   bool CanStageBulk() const final { return kCanStageBulk; }
+
+   void StageBulkEntry(Long64_t, std::size_t idx, std::size_t bulkSize) final
+   {
+      if constexpr (kCanStageBulk) {
+         if (fBulkValues.size() < bulkSize)
+            fBulkValues.resize(bulkSize);
+         fBulkValues[idx] = **fDSValuePtr;
+      }
+   }
 };
 
 } // namespace RDF
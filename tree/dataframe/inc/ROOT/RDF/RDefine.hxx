@@ -21,7 +21,9 @@
 #include "RtypesCore.h"
 
 #include <array>
+#include <cstddef> // std::size_t
 #include <deque>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -66,6 +68,15 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
 
+   static constexpr bool kSupportsBulk =
+      std::is_default_constructible<ret_type>::value && std::is_move_assignable<ret_type>::value;
+   /// Values of the current bulk of entries per slot, in bulk processing mode
+   std::vector<ROOT::RVec<ret_type>> fBulkResults;
+   /// Per slot, the entries of the current bulk for which the value has already been computed
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkDone;
+   /// Per slot, the entries of the current bulk for which the value must be computed in this UpdateBulk() call
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkRequest;
+
    /// Define objects corresponding to systematic variations other than nominal for this defined column.
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
@@ -94,12 +105,33 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
          fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RDFInternal::RMaskedEntryRange &request, TypeList<ColTypes...>,
+                         std::index_sequence<S...>)
+   {
+      auto *results = fBulkResults[slot].data();
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(request)...};
+      const auto bulkSize = request.Size();
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!request[i])
+            continue;
+         if constexpr (std::is_same<ExtraArgsTag, SlotAndEntryTag>::value)
+            results[i] = fExpression(slot, request.FirstEntry() + i, std::get<S>(values)[i]...);
+         else if constexpr (std::is_same<ExtraArgsTag, SlotTag>::value)
+            results[i] = fExpression(slot, std::get<S>(values)[i]...);
+         else
+            results[i] = fExpression(std::get<S>(values)[i]...);
+      }
+      (void)values; // avoid unused variable warning for defines without input columns
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBulkResults(lm.GetNSlots()), fBulkDone(lm.GetNSlots()), fBulkRequest(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +145,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkDone[slot].Invalidate();
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -126,6 +159,7 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
+         RDFInternal::RNodeProfiler::RScope profile(fLoopManager->GetProfiler(), slot, this);
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
@@ -133,6 +167,41 @@ public:
 
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
+   bool SupportsBulk() const final { return kSupportsBulk; }
+
+   /// Compute the values of the entries selected by the mask that have not been computed yet for the current bulk
+   void UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      auto &done = fBulkDone[slot];
+      const auto bulkSize = mask.Size();
+      if (!done.Matches(mask.FirstEntry(), bulkSize)) {
+         done.Reset(mask.FirstEntry(), bulkSize, /*value=*/false);
+         if constexpr (kSupportsBulk) {
+            if (fBulkResults[slot].size() < bulkSize)
+               fBulkResults[slot].resize(bulkSize);
+         }
+      }
+
+      auto &request = fBulkRequest[slot];
+      request.Reset(mask.FirstEntry(), bulkSize, /*value=*/false);
+      bool anyRequested = false;
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (mask[i] && !done[i]) {
+            request[i] = true;
+            done[i] = true;
+            anyRequested = true;
+         }
+      }
+      if constexpr (kSupportsBulk) {
+         if (anyRequested) {
+            RDFInternal::RNodeProfiler::RScope profile(fLoopManager->GetProfiler(), slot, this);
+            UpdateBulkHelper(slot, request, ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
+   }
+
+   void *GetBulkValuePtr(unsigned int slot) final { return static_cast<void *>(fBulkResults[slot].data()); }
+
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
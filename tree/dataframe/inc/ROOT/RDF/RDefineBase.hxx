@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,9 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// The expression of a jitted define or the name of a built-in column, empty if the define calls a compiled
+   /// callable.
+   std::string fExpression;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -62,10 +66,20 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   void SetExpression(std::string_view expression) { fExpression = expression; }
+   const std::string &GetExpression() const { return fExpression; }
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
+   /// Return true if the define can compute its values for a bulk of entries at a time, see UpdateBulk()
+   virtual bool SupportsBulk() const { return false; }
+   /// Compute the values of the entries selected by the mask, in bulk processing mode
+   virtual void UpdateBulk(unsigned int /*slot*/, const RDFInternal::RMaskedEntryRange & /*mask*/) {}
+   /// Return the (type-erased) address of the values of the current bulk of entries for the given processing slot.
+   virtual void *GetBulkValuePtr(unsigned int /*slot*/) { return nullptr; }
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
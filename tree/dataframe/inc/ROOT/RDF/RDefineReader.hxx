@@ -47,6 +47,12 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
       return fValuePtr;
    }
 
+   void *GetBulkImpl(const RMaskedEntryRange &mask) final
+   {
+      fDefine.UpdateBulk(fSlot, mask);
+      return fDefine.GetBulkValuePtr(fSlot);
+   }
+
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define)
       : fDefine(define), fValuePtr(define.GetValuePtr(slot)), fSlot(slot)
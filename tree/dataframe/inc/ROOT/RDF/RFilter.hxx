@@ -22,8 +22,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -96,6 +98,7 @@ public:
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RNodeProfiler::RScope profile(fLoopManager->GetProfiler(), slot, this);
             auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
@@ -106,6 +109,38 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      auto &mask = fBulkMasks[slot];
+      if (!mask.Matches(firstEntry, bulkSize)) {
+         // start from the entries that passed the upstream filters and deselect the ones that fail this filter
+         mask = fPrevNode.CheckFiltersBulk(slot, firstEntry, bulkSize);
+         RDFInternal::RNodeProfiler::RScope profile(fLoopManager->GetProfiler(), slot, this);
+         CheckFilterBulkHelper(slot, mask, ColumnTypes_t{}, TypeInd_t{});
+      }
+      return mask;
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, RDFInternal::RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                              std::index_sequence<S...>)
+   {
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(mask)...};
+      const auto bulkSize = mask.Size();
+      ULong64_t nAccepted = 0;
+      ULong64_t nRejected = 0;
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         const bool passed = fFilter(std::get<S>(values)[i]...);
+         passed ? ++nAccepted : ++nRejected;
+         mask[i] = passed;
+      }
+      fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+      fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+      (void)values; // avoid unused variable warning for filters without input columns
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -120,6 +155,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkMasks[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
@@ -14,10 +14,12 @@
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+#include "ROOT/RDataSource.hxx" // RColumnPredicate
 #include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
 
 #include <cassert>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -41,6 +43,8 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Per slot, the entries of the current bulk that pass this filter and all upstream filters, in bulk processing mode
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -48,6 +52,11 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// A data source predicate equivalent to this filter, set for unnamed filters of the form `column op constant`
+   /// that hang directly from the RLoopManager.
+   std::optional<ROOT::RDF::RColumnPredicate> fPushDownPredicate;
+   /// The expression of a jitted filter, empty if the filter calls a compiled callable.
+   std::string fExpression;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -60,7 +69,15 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   const ROOT::RDF::ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   void SetExpression(std::string_view expression) { fExpression = expression; }
+   const std::string &GetExpression() const { return fExpression; }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
+   /// Return the number of entries that passed the filter, summed over the processing slots
+   ULong64_t GetAccepted() const;
+   /// Return the number of entries that did not pass the filter, summed over the processing slots
+   ULong64_t GetRejected() const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
    {
@@ -69,6 +86,12 @@ public:
       std::fill(fAccepted.begin(), fAccepted.end(), 0);
       std::fill(fRejected.begin(), fRejected.end(), 0);
    }
+   void SetPushDownPredicate(const ROOT::RDF::RColumnPredicate &predicate) { fPushDownPredicate = predicate; }
+   /// Return the equivalent data source predicate, if any, provided that the filter takes part in the event loop
+   const ROOT::RDF::RColumnPredicate *GetPushDownPredicate() const
+   {
+      return (fPushDownPredicate && fNChildren > 0) ? &*fPushDownPredicate : nullptr;
+   }
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
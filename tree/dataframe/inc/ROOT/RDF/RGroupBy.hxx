@@ -0,0 +1,247 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RGROUPBY
+#define ROOT_RDF_RGROUPBY
+
+#include "ROOT/RDF/HistoModels.hxx"
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/RDF/Utils.hxx" // IsDataContainer, IsHashable
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+#include "TDirectory.h"
+#include "TH1.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+
+/**
+\class ROOT::RDF::RGroupStats
+\ingroup dataframe
+\brief Summary statistics of the values of a column for one group of entries, see RGroupBy::Agg().
+**/
+class RGroupStats {
+   ULong64_t fCount = 0;
+   double fSum = 0.;
+   double fMin = std::numeric_limits<double>::max();
+   double fMax = std::numeric_limits<double>::lowest();
+
+public:
+   void Fill(double value)
+   {
+      ++fCount;
+      fSum += value;
+      fMin = std::min(fMin, value);
+      fMax = std::max(fMax, value);
+   }
+
+   void Merge(const RGroupStats &other)
+   {
+      fCount += other.fCount;
+      fSum += other.fSum;
+      fMin = std::min(fMin, other.fMin);
+      fMax = std::max(fMax, other.fMax);
+   }
+
+   ULong64_t GetCount() const { return fCount; }
+   double GetSum() const { return fSum; }
+   /// Return the mean of the values, 0 if there are none.
+   double GetMean() const { return fCount > 0 ? fSum / fCount : 0.; }
+   double GetMin() const { return fMin; }
+   double GetMax() const { return fMax; }
+};
+
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+inline void FillGroup(ROOT::RDF::RGroupStats &group, double value)
+{
+   group.Fill(value);
+}
+
+inline void FillGroup(TH1 &group, double value)
+{
+   group.Fill(value);
+}
+
+inline void MergeGroup(ROOT::RDF::RGroupStats &group, const ROOT::RDF::RGroupStats &other)
+{
+   group.Merge(other);
+}
+
+inline void MergeGroup(TH1 &group, const TH1 &other)
+{
+   group.Add(&other);
+}
+
+/// Action helper that aggregates the values of a column separately for each value of a key column.
+/// Each processing slot aggregates into its own hash table (an ordered map if the key type has no std::hash), so
+/// that no synchronization is needed during the event loop; the tables are merged at the end.
+/// Groups are created as copies of a model, e.g. an empty RGroupStats or an empty histogram.
+template <typename KeyT, typename Group_t>
+class R__CLING_PTRCHECK(off) GroupByHelper : public ROOT::Detail::RDF::RActionImpl<GroupByHelper<KeyT, Group_t>> {
+   using SlotGroups_t = std::conditional_t<IsHashable<KeyT>::value, std::unordered_map<KeyT, Group_t>,
+                                           std::map<KeyT, Group_t>>;
+
+public:
+   using Result_t = std::map<KeyT, Group_t>;
+
+private:
+   std::shared_ptr<Result_t> fResult;
+   std::shared_ptr<const Group_t> fModel;
+   std::vector<SlotGroups_t> fSlotGroups;
+
+   Group_t &GetGroup(unsigned int slot, const KeyT &key)
+   {
+      auto &groups = fSlotGroups[slot];
+      auto it = groups.find(key);
+      if (it == groups.end()) {
+         // copies of histograms must not be attached to the current directory
+         TDirectory::TContext ctxt(nullptr);
+         it = groups.emplace(key, *fModel).first;
+      }
+      return it->second;
+   }
+
+public:
+   GroupByHelper(const std::shared_ptr<Result_t> &result, const std::shared_ptr<const Group_t> &model,
+                 unsigned int nSlots)
+      : fResult(result), fModel(model), fSlotGroups(nSlots)
+   {
+   }
+   GroupByHelper(GroupByHelper &&) = default;
+   GroupByHelper(const GroupByHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename ValueT>
+   void Exec(unsigned int slot, const KeyT &key, const ValueT &value)
+   {
+      auto &group = GetGroup(slot, key);
+      if constexpr (IsDataContainer<ValueT>::value) {
+         for (const auto &v : value)
+            FillGroup(group, v);
+      } else {
+         FillGroup(group, value);
+      }
+   }
+
+   void Finalize()
+   {
+      fResult->clear();
+      TDirectory::TContext ctxt(nullptr);
+      for (auto &groups : fSlotGroups) {
+         for (auto &keyAndGroup : groups) {
+            auto it = fResult->find(keyAndGroup.first);
+            if (it == fResult->end())
+               fResult->emplace(keyAndGroup.first, std::move(keyAndGroup.second));
+            else
+               MergeGroup(it->second, keyAndGroup.second);
+         }
+         groups.clear();
+      }
+   }
+
+   std::string GetActionName() { return "GroupBy"; }
+
+   GroupByHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<Result_t> *>(newResult);
+      return GroupByHelper(result, fModel, fSlotGroups.size());
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+
+/**
+\class ROOT::RDF::RGroupBy
+\ingroup dataframe
+\brief Books actions that aggregate the values of columns separately for each value of a key column.
+
+Returned by RInterface::GroupBy(). Each action books a single node in the computation graph, whatever the number of
+distinct keys, and returns a map from each key to its aggregate:
+~~~{.cpp}
+auto byRun = df.GroupBy<unsigned int>("run");
+auto ptStats = byRun.Agg<float>("pt");                             // std::map<unsigned int, RGroupStats>
+auto ptHistos = byRun.Histo1D<float>({"pt", "pt", 100, 0, 100}, "pt"); // std::map<unsigned int, TH1D>
+std::cout << (*ptStats)[1].GetMean() << '\n';
+~~~
+Keys of several columns can be combined in a single column, e.g. `Define("runLumi", "std::make_pair(run, lumi)")`.
+Like all actions, these are lazy: the event loop runs when one of the results is accessed.
+**/
+template <typename KeyT, typename Interface_t>
+class RGroupBy {
+   Interface_t fInterface;
+   std::string fKeyColumn;
+
+   template <typename ValueT, typename Group_t>
+   auto Book(std::shared_ptr<const Group_t> model, std::string_view valueColumn)
+   {
+      using Helper_t = ROOT::Internal::RDF::GroupByHelper<KeyT, Group_t>;
+      auto result = std::make_shared<typename Helper_t::Result_t>();
+      const auto nSlots = fInterface.GetNSlots();
+      return fInterface.template Book<KeyT, ValueT>(Helper_t(result, model, nSlots),
+                                                    {fKeyColumn, std::string(valueColumn)});
+   }
+
+public:
+   RGroupBy(const Interface_t &df, std::string_view keyColumn) : fInterface(df), fKeyColumn(keyColumn) {}
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the number of entries, sum, mean, minimum and maximum of a column for each key.
+   /// \tparam ValueT The type of the column, arithmetic or a collection of arithmetic values.
+   /// \param[in] valueColumn The name of the column.
+   template <typename ValueT>
+   RResultPtr<std::map<KeyT, RGroupStats>> Agg(std::string_view valueColumn)
+   {
+      return Book<ValueT>(std::make_shared<const RGroupStats>(), valueColumn);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Fill a one-dimensional histogram with the values of a column for each key.
+   /// \tparam ValueT The type of the column, arithmetic or a collection of arithmetic values.
+   /// \param[in] model The model of the histograms; their name is the one of the model.
+   /// \param[in] valueColumn The name of the column.
+   template <typename ValueT>
+   RResultPtr<std::map<KeyT, ::TH1D>> Histo1D(const TH1DModel &model, std::string_view valueColumn)
+   {
+      std::shared_ptr<::TH1D> h;
+      {
+         TDirectory::TContext ctxt(nullptr);
+         h = model.GetHistogram();
+         h->SetDirectory(nullptr);
+      }
+      return Book<ValueT>(std::shared_ptr<const ::TH1D>(std::move(h)), valueColumn);
+   }
+};
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RGROUPBY
@@ -19,8 +19,11 @@
 #include "ROOT/RDF/RDefine.hxx"
 #include "ROOT/RDF/RDefinePerSample.hxx"
 #include "ROOT/RDF/RFilter.hxx"
+#include "ROOT/RDF/RGroupBy.hxx"
 #include "ROOT/RDF/RInterfaceBase.hxx"
+#include "ROOT/RDF/RJoinTable.hxx"
 #include "ROOT/RDF/RVariation.hxx"
+#include "ROOT/RDF/RCacheDS.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRange.hxx"
@@ -88,6 +91,10 @@ namespace RDF {
 class GraphCreatorHelper;
 void ChangeEmptyEntryRange(const ROOT::RDF::RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
 void ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+void SetBulkSize(const ROOT::RDF::RNode &node, std::size_t bulkSize);
+void SetResultCache(const ROOT::RDF::RNode &node, std::string_view directory, std::string_view tag);
+void SetProfiling(const ROOT::RDF::RNode &node, bool enable);
+ROOT::RDF::Experimental::RProfileReport GetProfileReport(const ROOT::RDF::RNode &node);
 void TriggerRun(ROOT::RDF::RNode node);
 } // namespace RDF
 } // namespace Internal
@@ -121,6 +128,10 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void RDFInternal::SetBulkSize(const RNode &node, std::size_t bulkSize);
+   friend void RDFInternal::SetResultCache(const RNode &node, std::string_view directory, std::string_view tag);
+   friend void RDFInternal::SetProfiling(const RNode &node, bool enable);
+   friend ROOT::RDF::Experimental::RProfileReport RDFInternal::GetProfileReport(const RNode &node);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -1173,13 +1184,7 @@ public:
 
       ::TDirectory::TContext ctxt;
 
-      // The CreateLMFromTTree function by default opens the file passed as input
-      // to check for the presence of the TTree inside. But at this moment the
-      // filename we are using here corresponds to a file which does not exist yet,
-      // i.e. the output file of the Snapshot call. Thus, checkFile=false will
-      // prevent the function from trying to open a non-existent file.
-      auto newRDF = std::make_shared<RInterface<RLoopManager>>(ROOT::Detail::RDF::CreateLMFromTTree(
-         fullTreeName, filename, colListNoAliasesWithSizeBranches, /*checkFile*/ false));
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, filename, colListNoAliasesWithSizeBranches, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1265,6 +1270,9 @@ public:
    /// Use `Cache` if you know you will only need a subset of the (`Filter`ed) data that
    /// fits in memory and that will be accessed many times.
    ///
+   /// The memory used by each cached dataset can be limited with ROOT::RDF::Experimental::SetCacheMemoryBudget():
+   /// the columns that do not fit are moved to temporary files and read back from there when they are used.
+   ///
    /// \note Cache will refuse to process columns with names of the form `#columnname`. These are special columns
    /// made available by some data sources (e.g. RNTupleDS) that represent the size of column `columnname`, and are
    /// not meant to be written out with that name (which is not a valid C++ variable name). Instead, go through an
@@ -1380,6 +1388,44 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Add the columns of another dataset to the entries of this dataset that have the same key.
+   /// \tparam KeyT The type of the key column.
+   /// \tparam ColumnTypes The types of the columns of the other dataset.
+   /// \param[in] right Any node of the computation graph of the other dataset.
+   /// \param[in] keyColumn The name of the key column, in both datasets.
+   /// \param[in] columns The columns of the other dataset to add to this one.
+   /// \param[in] prefix A prefix for the names of the added columns, e.g. to avoid clashes with existing columns.
+   /// \return a node of the computation graph that only sees the entries of this dataset with a matching key, and that
+   /// has the added columns.
+   ///
+   /// This is a hash join: as Cache(), it immediately runs an event loop on the other dataset, which reads the key and
+   /// the selected columns sequentially and keeps them in memory, indexed by key. The event loop of this dataset then
+   /// reads its entries sequentially as usual, and looks the key of each entry up in the index. Unlike friend trees
+   /// indexed with a TTreeIndex, neither dataset is read in random order, and the entries of the two datasets do not
+   /// need to be sorted. The other dataset should be the smaller of the two, and its keys must be unique.
+   /// Keys made of several columns, e.g. run and event numbers, can be combined in a single column beforehand.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto addKey = [](ROOT::RDF::RNode df) {
+   ///    return df.Define("key", [](UInt_t run, ULong64_t event) { return (ULong64_t(run) << 40) | event; },
+   ///                     {"run", "event"});
+   /// };
+   /// auto reco = addKey(ROOT::RDataFrame("reco", "reco.root"));
+   /// auto truth = addKey(ROOT::RDataFrame("truth", "truth.root"));
+   /// auto joined = reco.Join<ULong64_t, float>(truth, "key", {"pt"}, "true_");
+   /// auto h = joined.Define("dpt", "pt - true_pt").Histo1D("dpt");
+   /// ~~~
+   template <typename KeyT, typename... ColumnTypes>
+   RNode
+   Join(const RNode &right, std::string_view keyColumn, const ColumnNames_t &columns, std::string_view prefix = "")
+   {
+      RDFInternal::CheckTypesAndPars(sizeof...(ColumnTypes), columns.size());
+      return JoinImpl<KeyT, ColumnTypes...>(right, keyColumn, columns, prefix,
+                                            std::index_sequence_for<ColumnTypes...>());
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -2721,6 +2767,7 @@ public:
       auto action = std::make_unique<Action_t>(
          Helper_t(std::move(aggregator), std::move(merger), accObjPtr, fLoopManager->GetNSlots()), validColumnNames,
          fProxiedPtr, fColRegister);
+      action->SetRunsUserCode();
       return MakeResultPtr(accObjPtr, *fLoopManager, std::move(action));
    }
 
@@ -2749,6 +2796,31 @@ public:
       return Aggregate(std::move(aggregator), std::move(merger), columnName, U());
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Group the entries by the value of a column, to book aggregations for each group.
+   /// \tparam KeyT The type of the key column.
+   /// \param[in] keyColumn The name of the key column.
+   /// \return An RGroupBy object, on which aggregations can be booked.
+   ///
+   /// Each aggregation booked on the returned object is a single action which fills, in each processing slot, a
+   /// hash table from the values of the key column to the partial aggregates; the tables are merged at the end of the
+   /// event loop. The result is a map from each key to its aggregate.
+   /// Grouping by several columns is possible by defining a column that combines them, e.g. a `std::pair`.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto byCharge = df.GroupBy<int>("charge");
+   /// auto ptStats = byCharge.Agg<float>("pt"); // count, sum, mean, min and max of pt for each charge
+   /// auto ptHistos = byCharge.Histo1D<float>({"pt", "pt", 100, 0, 100}, "pt"); // a histogram of pt for each charge
+   /// for (auto &[charge, stats] : *ptStats)
+   ///    std::cout << charge << ": " << stats.GetMean() << '\n';
+   /// ~~~
+   template <typename KeyT>
+   RGroupBy<KeyT, RInterface<Proxied, DS_t>> GroupBy(std::string_view keyColumn)
+   {
+      return RGroupBy<KeyT, RInterface<Proxied, DS_t>>(*this, keyColumn);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Book execution of a custom action using a user-defined helper object.
@@ -2986,6 +3058,38 @@ private:
       return *this; // never reached
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the RDataFrame returned by Snapshot, which reads the dataset written by the action.
+   std::shared_ptr<RInterface<RLoopManager>>
+   MakeSnapshotDataFrame(std::string_view fullTreeName, std::string_view filename,
+                         const ColumnNames_t &defaultColumns, RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat != ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+         // The CreateLMFromTTree function by default opens the file passed as input
+         // to check for the presence of the TTree inside. But at this moment the
+         // filename we are using here corresponds to a file which does not exist yet,
+         // i.e. the output file of the Snapshot call. Thus, checkFile=false will
+         // prevent the function from trying to open a non-existent file.
+         return std::make_shared<RInterface<RLoopManager>>(
+            ROOT::Detail::RDF::CreateLMFromTTree(fullTreeName, filename, defaultColumns, /*checkFile=*/false));
+      }
+#ifdef R__HAS_ROOT7
+      // An RNTuple can only be opened once it is written: the returned RDataFrame is replaced by one that reads it
+      // at the end of the event loop of the Snapshot, i.e. before users can access it through the RResultPtr.
+      auto newRDF = std::make_shared<RInterface<RLoopManager>>(std::make_shared<RLoopManager>(0ull));
+      snapHelperArgs.fOnWritten = [weakRDF = std::weak_ptr<RInterface<RLoopManager>>(newRDF),
+                                   ntupleName = std::string(fullTreeName), fileName = std::string(filename),
+                                   defaultColumns] {
+         if (auto rdf = weakRDF.lock())
+            *rdf = RInterface<RLoopManager>(
+               ROOT::Detail::RDF::CreateLMFromRNTuple(ntupleName, fileName, defaultColumns));
+      };
+      return newRDF;
+#else
+      throw std::invalid_argument("Snapshot: writing an RNTuple requires ROOT to be built with root7=ON");
+#endif
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -3007,13 +3111,8 @@ private:
 
       ::TDirectory::TContext ctxt;
 
-      // The CreateLMFromTTree function by default opens the file passed as input
-      // to check for the presence of the TTree inside. But at this moment the
-      // filename we are using here corresponds to a file which does not exist yet,
-      // i.e. the output file of the Snapshot call. Thus, checkFile=false will
-      // prevent the function from trying to open a non-existent file.
-      auto newRDF = std::make_shared<RInterface<RLoopManager>>(ROOT::Detail::RDF::CreateLMFromTTree(
-         fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns, /*checkFile=*/false));
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns,
+                                          *snapHelperArgs);
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -3039,15 +3138,41 @@ private:
 
       RDFInternal::CheckTypesAndPars(sizeof...(ColTypes), columnListWithoutSizeColumns.size());
 
-      auto colHolders = std::make_tuple(Take<ColTypes>(columnListWithoutSizeColumns[S])...);
-      auto ds = std::make_unique<RLazyDS<ColTypes...>>(
-         std::make_pair(columnListWithoutSizeColumns[S], std::get<S>(colHolders))...);
+      auto columns = Book<ColTypes...>(
+         RDFInternal::RCacheHelper<ColTypes...>(fLoopManager->GetNSlots(), RDFInternal::GetCacheMemoryBudget(),
+                                                RDFInternal::GetCacheSpillDirectory()),
+         columnListWithoutSizeColumns);
+      auto ds = std::make_unique<RDFInternal::RCacheDS<ColTypes...>>(std::move(columns), columnListWithoutSizeColumns);
 
       RInterface<RLoopManager> cachedRDF(std::make_shared<RLoopManager>(std::move(ds), columnListWithoutSizeColumns));
 
       return cachedRDF;
    }
 
+   template <typename KeyT, typename... ColTypes, std::size_t... S>
+   RNode JoinImpl(RNode right, std::string_view keyColumn, const ColumnNames_t &columns, std::string_view prefix,
+                  std::index_sequence<S...>)
+   {
+      // read the keys and the columns of the other dataset in a single event loop
+      auto keys = right.Take<KeyT>(keyColumn);
+      auto colHolders = std::make_tuple(right.Take<ColTypes>(columns[S])...);
+      using Table_t = RDFInternal::RJoinTable<KeyT, ColTypes...>;
+      auto table = std::make_shared<Table_t>(fLoopManager->GetNSlots(), std::move(*keys),
+                                             std::move(*std::get<S>(colHolders))...);
+
+      const ColumnNames_t inputColumns{"rdfslot_", "rdfentry_", std::string(keyColumn)};
+      RNode joined = Filter([table](unsigned int slot, ULong64_t entry,
+                                    const KeyT &key) { return table->Find(slot, entry, key) != Table_t::kNoMatch; },
+                            inputColumns);
+      ((joined = joined.Define(std::string(prefix) + columns[S],
+                               [table](unsigned int slot, ULong64_t entry, const KeyT &key) -> ColTypes {
+                                  return table->template GetValue<S>(table->Find(slot, entry, key));
+                               },
+                               inputColumns)),
+       ...);
+      return joined;
+   }
+
    template <bool IsSingleColumn, typename F>
    RInterface<Proxied, DS_t>
    VaryImpl(const std::vector<std::string> &colNames, F &&expression, const ColumnNames_t &inputColumns,
@@ -45,9 +45,11 @@ public:
                  const std::vector<std::string> &prevVariations);
    ~RJittedAction();
 
-   void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
+   void SetAction(std::unique_ptr<RActionBase> a);
 
    void Run(unsigned int slot, Long64_t entry) final;
+   bool SupportsBulk() const final;
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
@@ -56,6 +58,7 @@ public:
    void *PartialUpdate(unsigned int slot) final;
    bool HasRun() const final;
    void SetHasRun() final;
+   std::string GetActionName() final;
 
    std::shared_ptr<GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<GraphDrawing::GraphNode>> &visitedMap) final;
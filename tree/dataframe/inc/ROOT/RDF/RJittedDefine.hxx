@@ -53,13 +53,20 @@ public:
    }
    ~RJittedDefine();
 
-   void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   void SetDefine(std::unique_ptr<RDefineBase> c)
+   {
+      c->SetExpression(fExpression);
+      fConcreteDefine = std::move(c);
+   }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final;
+   bool SupportsBulk() const final;
+   void UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final;
+   void *GetBulkValuePtr(unsigned int slot) final;
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
    RDefineBase &GetVariedDefine(const std::string &variationName) final;
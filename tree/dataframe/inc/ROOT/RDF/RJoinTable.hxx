@@ -0,0 +1,94 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RJOINTABLE
+#define ROOT_RDF_RJOINTABLE
+
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep, IsHashable
+#include "RtypesCore.h"
+
+#include <cstddef> // std::size_t
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RJoinTable
+\ingroup dataframe
+\brief The columns of the right-hand dataset of RInterface::Join(), indexed by key.
+
+The columns are stored in memory as read, entry after entry, and a hash table (an ordered map if the key type has no
+std::hash) maps each key to its entry. Find() remembers the last lookup of each processing slot, so that the Filter
+and the Defines of a join look the key of an entry up only once.
+**/
+template <typename KeyT, typename... ColTypes>
+class RJoinTable {
+   using Index_t = std::conditional_t<IsHashable<KeyT>::value, std::unordered_map<KeyT, std::size_t>,
+                                      std::map<KeyT, std::size_t>>;
+   struct RLookup {
+      Long64_t fEntry = -1;
+      std::size_t fIndex = 0;
+   };
+
+   Index_t fIndex;
+   std::tuple<std::vector<ColTypes>...> fColumns;
+   std::vector<RLookup> fLastLookups; ///< Per slot, with CacheLineStep spacing to avoid false sharing
+
+public:
+   static constexpr std::size_t kNoMatch = std::size_t(-1);
+
+   RJoinTable(unsigned int nSlots, std::vector<KeyT> &&keys, std::vector<ColTypes> &&...columns)
+      : fColumns(std::move(columns)...), fLastLookups(nSlots * CacheLineStep<RLookup>())
+   {
+      if constexpr (IsHashable<KeyT>::value)
+         fIndex.reserve(keys.size());
+      for (std::size_t i = 0; i < keys.size(); ++i) {
+         const auto inserted = fIndex.emplace(std::move(keys[i]), i);
+         if (!inserted.second) {
+            throw std::runtime_error("RDataFrame::Join: entries " + std::to_string(inserted.first->second) + " and " +
+                                     std::to_string(i) +
+                                     " of the joined dataset have the same key. Keys must identify a single entry.");
+         }
+      }
+   }
+
+   /// Return the index of the entry with this key in the table, or kNoMatch.
+   /// The entry number of the dataset being processed identifies repeated lookups of the same key by a slot.
+   std::size_t Find(unsigned int slot, ULong64_t entry, const KeyT &key)
+   {
+      auto &lookup = fLastLookups[slot * CacheLineStep<RLookup>()];
+      if (lookup.fEntry != static_cast<Long64_t>(entry)) {
+         const auto it = fIndex.find(key);
+         lookup.fIndex = it == fIndex.end() ? kNoMatch : it->second;
+         lookup.fEntry = entry;
+      }
+      return lookup.fIndex;
+   }
+
+   template <std::size_t I>
+   decltype(auto) GetValue(std::size_t index) const
+   {
+      return std::get<I>(fColumns)[index];
+   }
+
+   std::size_t GetNEntries() const { return fIndex.size(); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RJOINTABLE
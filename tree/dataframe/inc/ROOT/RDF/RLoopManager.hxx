@@ -14,10 +14,14 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfiler.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 
+#include <cstddef> // std::size_t
 #include <functional>
 #include <limits>
 #include <map>
@@ -106,6 +110,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
+class RJittedFilter;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -122,6 +128,8 @@ class RLoopManager : public RNodeBase {
    std::vector<RFilterBase *> fBookedNamedFilters; ///< Contains a subset of fBookedFilters, i.e. only the named filters
    std::vector<RRangeBase *> fBookedRanges;
    std::vector<RDefineBase *> fBookedDefines;
+   /// Contains the subset of fBookedDefines that are read by some node of the event loop, see SetupActiveDefines()
+   std::vector<RDefineBase *> fActiveDefines;
    std::vector<RDFInternal::RVariationBase *> fBookedVariations;
 
    /// Shared pointer to the input TTree. It does not delete the pointee if the TTree/TChain was passed directly as an
@@ -160,6 +168,30 @@ class RLoopManager : public RNodeBase {
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// State of the bulk of entries being collected by a processing slot, in bulk processing mode.
+   struct RBulkState {
+      bool fIsEnabled = false;  ///< Whether the current task of this slot processes entries in bulks
+      Long64_t fFirstEntry = -1; ///< The first entry of the bulk being collected
+      std::size_t fNEntries = 0; ///< The number of entries collected so far
+      std::vector<RColumnReaderBase *> fReaders; ///< The dataset column readers that stage their values
+      RDFInternal::RMaskedEntryRange fMask;      ///< All-selected mask of the bulk, returned by CheckFiltersBulk()
+   };
+   std::vector<RBulkState> fBulkStates;
+   /// Maximum number of entries per bulk; bulk processing is disabled if smaller than 2.
+   std::size_t fBulkSize{0};
+
+   /// On-disk cache of the results of the event loops, null if disabled.
+   std::unique_ptr<RDFInternal::RResultCache> fResultCache;
+   /// Per-node profiler of the event loops, null if profiling is disabled.
+   std::unique_ptr<RDFInternal::RNodeProfiler> fProfiler;
+   enum class EResultCacheStatus { kNone, kHit, kMustWrite };
+   EResultCacheStatus fResultCacheStatus{EResultCacheStatus::kNone};
+   std::string fResultCacheKey; ///< Key of the results of the current event loop, empty if they cannot be cached
+   /// Jitted Defines and unnamed Filters by a key that identifies their expression and their inputs, so that an
+   /// identical node that is booked again is only jitted and evaluated once, see BookDefineJit() and BookFilterJit().
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fJittedDefines;
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fJittedFilters;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
@@ -171,9 +203,20 @@ class RLoopManager : public RNodeBase {
    void RunTreeReader();
    void RunDataSourceMT();
    void RunDataSource();
+   void ProcessEntry(unsigned int slot, Long64_t entry);
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunDataBlockCallbacks(unsigned int slot);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
+   void InitBulkState(unsigned int slot);
+   bool CanRunBulk(unsigned int slot) const;
+   void StageBulkEntry(unsigned int slot, Long64_t entry);
+   void FlushBulk(unsigned int slot);
+   std::string MakeResultCacheKey() const;
+   bool ReadCachedResults();
+   void UpdateResultCache();
    void InitNodes();
+   void SetupActiveDefines();
+   void SetupPushDownPredicates();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
@@ -222,6 +265,11 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   /// End of recursive chain of calls: all the entries of the bulk are selected.
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, Long64_t, std::size_t) final
+   {
+      return fBulkStates[slot].fMask;
+   }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -260,6 +308,16 @@ public:
 
    void SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange);
    void ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   void SetBulkSize(std::size_t bulkSize) { fBulkSize = bulkSize; }
+   std::size_t GetBulkSize() const { return fBulkSize; }
+   void SetResultCache(std::string_view directory, std::string_view tag);
+   void SetProfiling(bool enable);
+   RDFInternal::RNodeProfiler *GetProfiler() const { return fProfiler.get(); }
+   ROOT::RDF::Experimental::RProfileReport GetProfileReport() const;
+   std::shared_ptr<RJittedDefine> GetJittedDefine(const std::string &key);
+   void AddJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define);
+   std::shared_ptr<RJittedFilter> GetJittedFilter(const std::string &key);
+   void AddJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter);
 
    std::unordered_set<std::string> &GetColumnNamesCache() { return fCachedColNames; }
    std::set<std::pair<std::string_view, std::unique_ptr<ROOT::Internal::RDF::RDefinesWithReaders>>> &
@@ -0,0 +1,62 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include <ROOT/RVec.hxx>
+#include <Rtypes.h> // Long64_t
+
+#include <algorithm>
+#include <cstddef> // std::size_t
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RMaskedEntryRange
+\ingroup dataframe
+\brief A bulk of consecutive entries together with a mask that selects some of them.
+
+In bulk processing mode, the nodes of the computation graph process several consecutive entries at a time.
+The mask marks which entries of the bulk passed all upstream filters.
+**/
+class RMaskedEntryRange {
+   ROOT::RVecB fMask;     ///< Boolean mask, one element per entry of the bulk
+   Long64_t fBegin = -1; ///< The first entry of the bulk, -1 if not set
+
+public:
+   RMaskedEntryRange() = default;
+
+   /// Set the bulk to the given range of entries, with all entries selected (or none, if `value` is false).
+   void Reset(Long64_t begin, std::size_t size, bool value = true)
+   {
+      fBegin = begin;
+      fMask.assign(size, value);
+   }
+   /// Mark the bulk as invalid, e.g. at the beginning of a new task.
+   void Invalidate() { fBegin = -1; }
+
+   Long64_t FirstEntry() const { return fBegin; }
+   std::size_t Size() const { return fMask.size(); }
+   /// Return true if this is the bulk of entries starting at `begin` with `size` entries.
+   bool Matches(Long64_t begin, std::size_t size) const { return fBegin == begin && fMask.size() == size; }
+
+   bool &operator[](std::size_t idx) { return fMask[idx]; }
+   bool operator[](std::size_t idx) const { return fMask[idx]; }
+
+   /// Return the number of selected entries.
+   std::size_t Count() const { return std::count(fMask.begin(), fMask.end(), true); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RMASKEDENTRYRANGE
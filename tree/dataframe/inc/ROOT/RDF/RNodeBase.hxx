@@ -11,10 +11,13 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
+#include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -54,6 +57,13 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Return the mask of the entries of the bulk [firstEntry, firstEntry + bulkSize) that pass all filters up to and
+   /// including this node. Used in bulk processing mode, only by nodes that support it.
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*bulkSize*/)
+   {
+      throw std::logic_error("This node does not support bulk processing.");
+   }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
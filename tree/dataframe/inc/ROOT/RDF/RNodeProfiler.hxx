@@ -0,0 +1,133 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILER
+#define ROOT_RDF_RNODEPROFILER
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "ROOT/RDF/Utils.hxx" // kCacheLineSize
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TFile;
+class TTreeReader;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RDefineBase;
+class RFilterBase;
+} // namespace RDF
+} // namespace Detail
+
+namespace Internal {
+namespace RDF {
+class RActionBase;
+
+/**
+\class ROOT::Internal::RDF::RNodeProfiler
+\ingroup dataframe
+\brief Measures the time spent in each node of a computation graph and the work done by each processing slot.
+
+Nodes time their evaluation with an RScope. Scopes nest, e.g. an action triggers the evaluation of the upstream
+filters, which trigger the evaluation of the Defines they read: each processing slot keeps the stack of open scopes,
+so that the time of the nested scopes is subtracted from the self time of the enclosing node.
+The statistics of the slots are only modified by the thread that runs the slot, and summed in EndLoop().
+**/
+class RNodeProfiler {
+public:
+   /// Time the evaluation of a node by a slot during the lifetime of the object. No-op if the profiler is null.
+   class RScope {
+      RNodeProfiler *fProfiler;
+      unsigned int fSlot;
+
+   public:
+      RScope(RNodeProfiler *profiler, unsigned int slot, const void *node) : fProfiler(profiler), fSlot(slot)
+      {
+         if (fProfiler)
+            fProfiler->Enter(fSlot, node);
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (fProfiler)
+            fProfiler->Exit(fSlot);
+      }
+   };
+
+private:
+   using Clock_t = std::chrono::steady_clock;
+
+   struct RNodeTimes {
+      ULong64_t fCalls = 0;
+      Long64_t fTotalTime = 0; ///< Nanoseconds
+      Long64_t fSelfTime = 0;  ///< Nanoseconds
+   };
+   struct RFrame {
+      std::size_t fNode;       ///< Index of the node, kUnknownNode for nodes that were not registered
+      Clock_t::time_point fStart;
+      Long64_t fChildTime = 0; ///< Nanoseconds spent in nested scopes
+   };
+   /// Aligned to avoid false sharing between slots, which update their data for every entry
+   struct alignas(kCacheLineSize) RSlotData {
+      std::vector<RNodeTimes> fNodes;
+      std::vector<RFrame> fStack;
+      ULong64_t fEntries = 0;
+      Long64_t fBytesRead = 0;
+      unsigned int fNTasks = 0;
+      Long64_t fTime = 0;
+      // state of the current task
+      Clock_t::time_point fTaskStart;
+      ULong64_t fTaskFirstEntry = 0;
+      std::vector<Long64_t> fTaskSelfTimes;
+      TFile *fTaskFile = nullptr;
+      Long64_t fTaskBytesAtStart = 0;
+   };
+   static constexpr std::size_t kUnknownNode = std::size_t(-1);
+
+   std::vector<RSlotData> fSlots;
+   std::unordered_map<const void *, std::size_t> fNodeIndices;
+   /// The filters of the registered nodes, null for other nodes, to retrieve their pass rates
+   std::vector<const ROOT::Detail::RDF::RFilterBase *> fFilters;
+   std::vector<std::pair<ULong64_t, ULong64_t>> fFilterCountsAtStart;
+   Clock_t::time_point fLoopStart;
+   std::mutex fTasksMutex; ///< Protects the tasks of fReport, which are added by the slots
+   ROOT::RDF::Experimental::RProfileReport fReport;
+
+   void AddNode(const void *node, const std::string &kind, const std::string &name);
+
+public:
+   RNodeProfiler(unsigned int nSlots);
+
+   void BeginLoop(const std::vector<ROOT::Detail::RDF::RFilterBase *> &filters,
+                  const std::vector<ROOT::Detail::RDF::RDefineBase *> &defines,
+                  const std::vector<RActionBase *> &actions);
+   void EndLoop();
+   void BeginTask(unsigned int slot, TTreeReader *r);
+   void EndTask(unsigned int slot, TTreeReader *r);
+   void CountEntry(unsigned int slot) { ++fSlots[slot].fEntries; }
+   void Enter(unsigned int slot, const void *node);
+   void Exit(unsigned int slot);
+
+   /// Return the report of the last event loop.
+   const ROOT::RDF::Experimental::RProfileReport &GetReport() const { return fReport; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RNODEPROFILER
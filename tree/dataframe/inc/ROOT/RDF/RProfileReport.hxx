@@ -0,0 +1,103 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILEREPORT
+#define ROOT_RDF_RPROFILEREPORT
+
+#include "RtypesCore.h"
+
+#include <cstddef> // std::size_t
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+namespace RDF {
+class RNodeProfiler;
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+/// Time spent in a node of the computation graph during an event loop, see RProfileReport.
+struct RNodeProfile {
+   std::string fKind;          ///< "Filter", "Define" or "Action"
+   std::string fName;          ///< Name of the filter, of the defined column or of the action
+   ULong64_t fCalls = 0;       ///< Number of evaluations of the node, summed over the processing slots
+   double fTotalTime = 0.;     ///< Seconds spent evaluating the node, including the upstream nodes it triggered
+   double fSelfTime = 0.;      ///< Seconds spent evaluating the node, excluding the upstream Filters and Defines
+   ULong64_t fPass = 0;        ///< For filters, the number of entries that passed the filter
+   ULong64_t fAll = 0;         ///< For filters, the number of entries that were checked by the filter
+};
+
+/// Work done by a processing slot during an event loop, see RProfileReport.
+struct RSlotProfile {
+   unsigned int fSlot = 0;
+   unsigned int fNTasks = 0;   ///< Number of tasks run by the slot
+   ULong64_t fEntries = 0;     ///< Number of entries processed by the slot
+   Long64_t fBytesRead = 0;    ///< Bytes read from the input files by the slot
+   double fTime = 0.;          ///< Seconds spent running tasks
+};
+
+/// A task of an event loop, i.e. a range of entries processed by one slot, see RProfileReport.
+struct RTaskProfile {
+   unsigned int fSlot = 0;
+   double fStart = 0.;         ///< Seconds from the beginning of the event loop
+   double fDuration = 0.;      ///< Duration of the task in seconds
+   ULong64_t fEntries = 0;     ///< Number of entries processed by the task
+   Long64_t fBytesRead = 0;    ///< Bytes read from the input file by the task
+   std::string fInput;         ///< Name of the input file, if any
+   /// Self time of the nodes during the task, as pairs of index in RProfileReport::GetNodes() and seconds
+   std::vector<std::pair<std::size_t, double>> fNodeTimes;
+};
+
+/**
+\class ROOT::RDF::Experimental::RProfileReport
+\ingroup dataframe
+\brief Per-node timing and per-slot I/O statistics of an event loop, see ROOT::RDF::Experimental::EnableProfiling().
+
+The self time of a node is the time spent in the node minus the time spent in the upstream Filters and Defines that
+it triggered: the self time of a Define is the evaluation of its expression, the self time of an action is the
+execution of the action (e.g. filling a histogram). The time spent reading dataset columns is attributed to the node
+that first reads them.
+The report can be exported as JSON or in the trace event format that can be loaded in chrome://tracing or Perfetto.
+**/
+class RProfileReport {
+   friend class ROOT::Internal::RDF::RNodeProfiler;
+
+   std::vector<RNodeProfile> fNodes;
+   std::vector<RSlotProfile> fSlots;
+   std::vector<RTaskProfile> fTasks;
+   double fTime = 0.; ///< Elapsed seconds of the event loop
+
+public:
+   using const_iterator = typename std::vector<RNodeProfile>::const_iterator;
+
+   const std::vector<RNodeProfile> &GetNodes() const { return fNodes; }
+   const std::vector<RSlotProfile> &GetSlots() const { return fSlots; }
+   const std::vector<RTaskProfile> &GetTasks() const { return fTasks; }
+   double GetTime() const { return fTime; }
+   const RNodeProfile &At(std::string_view name) const;
+   const_iterator begin() const { return fNodes.begin(); }
+   const_iterator end() const { return fNodes.end(); }
+
+   /// Print the nodes sorted by decreasing self time, and the work done by each slot.
+   void Print() const;
+   std::string AsJSON() const;
+   std::string AsChromeTrace() const;
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILEREPORT
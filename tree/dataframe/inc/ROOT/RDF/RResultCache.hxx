@@ -0,0 +1,168 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTCACHE
+#define ROOT_RDF_RRESULTCACHE
+
+#include <RtypesCore.h> // Long64_t
+#include <TDirectory.h>
+#include <TObject.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RResultCacheIOBase
+\ingroup dataframe
+\brief Type-erased access to the result of an action, to store it into and restore it from an RResultCache.
+**/
+class RResultCacheIOBase {
+public:
+   virtual ~RResultCacheIOBase() = default;
+   /// Return a text representation of the result, e.g. to include the binning of a histogram model in the key.
+   virtual std::string Serialize() const = 0;
+   /// Write the result into the directory with the given name. Return false on failure.
+   virtual bool Write(TDirectory &dir, const std::string &name) const = 0;
+   /// Read a result from the directory and keep it until Apply() is called. Return false on failure.
+   virtual bool Read(TDirectory &dir, const std::string &name) = 0;
+   /// Replace the value of the result with the one previously read.
+   virtual void Apply() = 0;
+};
+
+/// Return the streamed representation of the object, hex-encoded.
+std::string SerializeObject(const TObject &obj);
+void DetachFromDirectory(TObject &obj);
+bool WriteValue(TDirectory &dir, const std::string &name, Long64_t value);
+bool WriteValue(TDirectory &dir, const std::string &name, Double_t value);
+bool ReadValue(TDirectory &dir, const std::string &name, Long64_t &value);
+bool ReadValue(TDirectory &dir, const std::string &name, Double_t &value);
+
+/// Cache IO for results that inherit from TObject, e.g. histograms, graphs and profiles.
+template <typename T>
+class RObjectResultCacheIO final : public RResultCacheIOBase {
+   std::shared_ptr<T> fResult;
+   std::unique_ptr<T> fReadResult;
+
+public:
+   RObjectResultCacheIO(const std::shared_ptr<T> &result) : fResult(result) {}
+
+   std::string Serialize() const final { return SerializeObject(*fResult); }
+
+   bool Write(TDirectory &dir, const std::string &name) const final
+   {
+      return dir.WriteTObject(fResult.get(), name.c_str()) > 0;
+   }
+
+   bool Read(TDirectory &dir, const std::string &name) final
+   {
+      auto *obj = dir.Get<T>(name.c_str());
+      if (!obj)
+         return false;
+      // the directory is closed right after reading, it must not own the object
+      DetachFromDirectory(*obj);
+      fReadResult.reset(obj);
+      return true;
+   }
+
+   void Apply() final
+   {
+      if (!fReadResult)
+         return;
+      // do not let the copy register itself to gDirectory, as for the results of the event loop
+      TDirectory::TContext ctxt(nullptr);
+      *fResult = *fReadResult;
+      fReadResult.reset();
+   }
+};
+
+/// Cache IO for arithmetic results, e.g. those of Count, Sum, Mean, Min and Max.
+template <typename T>
+class RValueResultCacheIO final : public RResultCacheIOBase {
+   using Stored_t = std::conditional_t<std::is_integral<T>::value, Long64_t, Double_t>;
+
+   std::shared_ptr<T> fResult;
+   Stored_t fReadResult{};
+   bool fHasReadResult = false;
+
+public:
+   RValueResultCacheIO(const std::shared_ptr<T> &result) : fResult(result) {}
+
+   std::string Serialize() const final { return std::string(typeid(T).name()) + ':' + std::to_string(*fResult); }
+
+   bool Write(TDirectory &dir, const std::string &name) const final
+   {
+      return WriteValue(dir, name, static_cast<Stored_t>(*fResult));
+   }
+
+   bool Read(TDirectory &dir, const std::string &name) final
+   {
+      fHasReadResult = ReadValue(dir, name, fReadResult);
+      return fHasReadResult;
+   }
+
+   void Apply() final
+   {
+      if (fHasReadResult)
+         *fResult = static_cast<T>(fReadResult);
+      fHasReadResult = false;
+   }
+};
+
+/// Return the cache IO for the given action result, or null if results of this type cannot be cached.
+template <typename T>
+std::unique_ptr<RResultCacheIOBase> MakeResultCacheIO(const std::shared_ptr<T> &result)
+{
+   if constexpr (std::is_base_of<TObject, T>::value && std::is_copy_assignable<T>::value)
+      return std::make_unique<RObjectResultCacheIO<T>>(result);
+   else if constexpr (std::is_arithmetic<T>::value && sizeof(T) <= sizeof(Double_t))
+      return std::make_unique<RValueResultCacheIO<T>>(result);
+   else
+      return nullptr;
+}
+
+/**
+\class ROOT::Internal::RDF::RResultCache
+\ingroup dataframe
+\brief A directory of ROOT files that store the results of event loops, addressed by a key that describes them.
+
+Each event loop is stored in a file whose name is the MD5 digest of the key. The file also contains the full key,
+so that digest collisions are detected. Files are written to a temporary name first and renamed once complete, so
+that concurrent processes never read partially written files.
+**/
+class RResultCache {
+   std::string fDirectory;
+   std::string fTag;
+
+   std::string GetFileName(const std::string &key) const;
+
+public:
+   RResultCache(std::string_view directory, std::string_view tag);
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   const std::string &GetTag() const { return fTag; }
+
+   /// Read all results stored for the key. Only returns true if all of them could be read, in which case they can be
+   /// applied with RResultCacheIOBase::Apply().
+   bool Read(const std::string &key, const std::vector<RResultCacheIOBase *> &results) const;
+   /// Store the results for the key, replacing previously stored results with the same key. Return false on failure.
+   bool Write(const std::string &key, const std::vector<RResultCacheIOBase *> &results) const;
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTCACHE
@@ -12,14 +12,17 @@
 #define ROOT_RDF_RTREECOLUMNREADER
 
 #include "RColumnReaderBase.hxx"
+#include "RMaskedEntryRange.hxx"
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace ROOT {
 namespace Internal {
@@ -30,7 +33,13 @@ template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
 
+   static constexpr bool kCanStageBulk = std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value;
+   /// Copies of the values of the current bulk of entries, in bulk processing mode
+   RVec<T> fBulkValues;
+
    void *GetImpl(Long64_t) final { return fTreeValue->Get(); }
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.data(); }
+
 public:
    /// Construct the RTreeColumnReader. Actual initialization is performed lazily by the Init method.
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
@@ -47,6 +56,17 @@ public:
    // - Thread #1) first task deletes TTreeReader
    // See https://github.com/root-project/root/commit/26e8ace6e47de6794ac9ec770c3bbff9b7f2e945
    ~RTreeColumnReader() override { fTreeValue.reset(); }
+
+   bool CanStageBulk() const final { return kCanStageBulk; }
+
+   void StageBulkEntry(Long64_t entry, std::size_t idx, std::size_t bulkSize) final
+   {
+      if constexpr (kCanStageBulk) {
+         if (fBulkValues.size() < bulkSize)
+            fBulkValues.resize(bulkSize);
+         fBulkValues[idx] = *static_cast<T *>(GetImpl(entry));
+      }
+   }
 };
 
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderArrays.
@@ -70,6 +90,11 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
    /// Whether we already printed a warning about performing a copy of the TTreeReaderArray contents
    bool fCopyWarningPrinted = false;
 
+   /// Copies of the arrays of the current bulk of entries, in bulk processing mode
+   RVec<RVec<T>> fBulkValues;
+
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.data(); }
+
    void *GetImpl(Long64_t entry) final
    {
       if (entry == fLastEntry)
@@ -138,6 +163,17 @@ public:
 
    /// See the other class template specializations for an explanation.
    ~RTreeColumnReader() override { fTreeArray.reset(); }
+
+   bool CanStageBulk() const final { return true; }
+
+   /// The array values are copied: the RVec returned by GetImpl() might only be a view on the TTreeReaderArray memory.
+   void StageBulkEntry(Long64_t entry, std::size_t idx, std::size_t bulkSize) final
+   {
+      if (fBulkValues.size() < bulkSize)
+         fBulkValues.resize(bulkSize);
+      const auto &rvec = *static_cast<RVec<T> *>(GetImpl(entry));
+      fBulkValues[idx].assign(rvec.begin(), rvec.end());
+   }
 };
 
 /// RTreeColumnReader specialization for arrays of boolean values read via TTreeReaderArrays.
@@ -151,6 +187,11 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<bool>> final : public ROOT::
    /// We return a reference to this RVec to clients, to guarantee a stable address and contiguous memory layout
    RVec<bool> fRVec;
 
+   /// Copies of the arrays of the current bulk of entries, in bulk processing mode
+   RVec<RVec<bool>> fBulkValues;
+
+   void *GetBulkImpl(const RMaskedEntryRange &) final { return fBulkValues.data(); }
+
    // We always copy the contents of TTreeReaderArray<bool> into an RVec<bool> (never take a view into the memory
    // buffer) because the underlying memory buffer might be the one of a std::vector<bool>, which is not a contiguous
    // slab of bool values.
@@ -179,6 +220,17 @@ public:
 
    /// See the other class template specializations for an explanation.
    ~RTreeColumnReader() override { fTreeArray.reset(); }
+
+   bool CanStageBulk() const final { return true; }
+
+   /// The array values are copied: the RVec returned by GetImpl() might only be a view on the TTreeReaderArray memory.
+   void StageBulkEntry(Long64_t entry, std::size_t idx, std::size_t bulkSize) final
+   {
+      if (fBulkValues.size() < bulkSize)
+         fBulkValues.resize(bulkSize);
+      const auto &rvec = *static_cast<RVec<bool> *>(GetImpl(entry));
+      fBulkValues[idx].assign(rvec.begin(), rvec.end());
+   }
 };
 
 } // namespace RDF
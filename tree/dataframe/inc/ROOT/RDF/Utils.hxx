@@ -24,6 +24,7 @@
 #include <new> // std::hardware_destructive_interference_size
 #include <string>
 #include <type_traits> // std::decay, std::false_type
+#include <utility> // std::declval
 #include <vector>
 
 class TTree;
@@ -123,6 +124,13 @@ struct IsVector_t : public std::false_type {};
 template <typename T, typename A>
 struct IsVector_t<std::vector<T, A>> : public std::true_type {};
 
+/// Detect whether std::hash is usable for a type, e.g. to choose between a hash table and an ordered map
+template <typename T, typename = void>
+struct IsHashable : std::false_type {};
+
+template <typename T>
+struct IsHashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>> : std::true_type {};
+
 const std::type_info &TypeName2TypeID(const std::string &name);
 
 std::string TypeID2TypeName(const std::type_info &id);
@@ -189,14 +197,25 @@ void Erase(const T &that, std::vector<T> &v)
    v.erase(std::remove(v.begin(), v.end(), that), v.end());
 }
 
-/// Declare code in the interpreter via the TInterpreter::Declare method, throw in case of errors
-void InterpreterDeclare(const std::string &code);
+/// Declare code in the interpreter via the TInterpreter::Declare method, throw in case of errors.
+/// If `name` is not empty, the code is also recorded for CompiledCalc, which compiles it along with the code that
+/// refers to `name`.
+void InterpreterDeclare(const std::string &code, const std::string &name = "");
 
 /// Jit code in the interpreter with TInterpreter::Calc, throw in case of errors.
 /// The optional `context` parameter, if present, is mentioned in the error message.
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Set the directory of the shared libraries built by CompiledCalc; an empty string disables them.
+void SetJitCacheDirectory(std::string_view directory);
+
+/// Run code meant for InterpreterCalc from a shared library compiled ahead of time, built with the declarations of
+/// InterpreterDeclare whose names the code refers to and cached in the directory set by SetJitCacheDirectory, keyed
+/// by the digest of the code.
+/// Return false, without running the code, if the cache is disabled or the code could not be compiled.
+bool CompiledCalc(const std::string &code, const std::string &context = "");
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
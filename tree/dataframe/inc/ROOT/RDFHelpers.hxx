@@ -15,6 +15,7 @@
 
 #include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RDF/RActionBase.hxx>
+#include <ROOT/RDF/RProfileReport.hxx>
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
 #include <ROOT/TypeTraits.hxx>
@@ -297,6 +298,130 @@ void AddProgressBar(ROOT::RDF::RNode df);
 /// For more details see ROOT::RDF::Experimental::ProgressHelper Class.
 void AddProgressBar(ROOT::RDataFrame df);
 
+/// \brief Enable bulk processing for the computation graph of an RDataFrame
+/// \param[in] df Any node of the computation graph.
+/// \param[in] bulkSize Maximum number of consecutive entries processed at a time; 0 or 1 disable bulk processing.
+///
+/// By default, the event loop runs each entry through the whole computation graph before moving on to the next one.
+/// In bulk processing mode, the values of the dataset columns are first collected for up to `bulkSize` consecutive
+/// entries. Then each Filter, Define and action processes the whole bulk in one call, keeping track of the entries
+/// that passed the filters with a mask. This amortizes the per-entry overhead of the computation graph, which
+/// dominates analyses with many simple cuts. One-dimensional histograms with a model are filled with TH1::FillN().
+///
+/// As a consequence, all the dataset columns used anywhere in the computation graph are read for every entry, and the
+/// callables of different nodes are not interleaved entry by entry anymore. The event loop falls back to processing
+/// one entry at a time if the computation graph contains Range, Vary, DefinePerSample, Snapshot or Display nodes,
+/// or if some of the columns cannot be copied (e.g. non-copiable types or data sources with custom column readers).
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::SetBulkSize(df, 1024);
+/// auto h = df.Filter("x > 1").Filter("y < 2").Histo1D({"h", "h", 100, 0, 10}, "z");
+/// ~~~
+void SetBulkSize(ROOT::RDF::RNode df, std::size_t bulkSize);
+
+/// \brief Enable bulk processing for an RDataFrame, see SetBulkSize(ROOT::RDF::RNode, std::size_t)
+void SetBulkSize(ROOT::RDataFrame df, std::size_t bulkSize);
+
+/// \brief Store the results of the event loops of an RDataFrame on disk and reuse them when nothing changed
+/// \param[in] df Any node of the computation graph.
+/// \param[in] directory The directory that holds the cached results; an empty string disables the cache.
+/// \param[in] tag A string that identifies the compiled code of the computation graph, see below.
+///
+/// Before each event loop, a key is computed from the input files (name, size and modification time), the entry
+/// range, the names, input columns and jitted expressions of all Filters and Defines, and the actions with the
+/// initial state of their results (e.g. histogram models). If the results of an event loop with the same key are
+/// found in the directory, they are read from there and the event loop does not run. Otherwise the event loop runs
+/// and its results are written to the directory.
+///
+/// Only event loops over TTrees stored in files or over empty sources are cached, and only if all actions return
+/// arithmetic values (e.g. Count, Sum, Mean) or copiable TObjects (e.g. histograms and graphs). Event loops with
+/// Snapshot, Take, Report or systematic variations always run.
+///
+/// The code of compiled callables, e.g. those passed to Filter, Define, Aggregate or Book, cannot be part of the key.
+/// Results of computation graphs that contain them are only cached if a tag is given, which stands for that code.
+/// \warning When the compiled code changes, use a different tag or remove the contents of the directory.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableResultCache(df, "rdfcache");
+/// auto h = df.Filter("x > 1").Histo1D({"h", "h", 100, 0, 10}, "y");
+/// h->Draw(); // the second time this program runs, h is read from rdfcache
+/// ~~~
+void EnableResultCache(ROOT::RDF::RNode df, std::string_view directory, std::string_view tag = "");
+
+/// \brief Enable the result cache of an RDataFrame, see EnableResultCache(ROOT::RDF::RNode, std::string_view, std::string_view)
+void EnableResultCache(ROOT::RDataFrame df, std::string_view directory, std::string_view tag = "");
+
+/// \brief Compile the code that RDataFrame jits into shared libraries, cached in a directory.
+/// \param[in] directory The directory of the shared libraries; an empty string disables the cache.
+///
+/// The just-in-time compilation of the string expressions of Filter and Define and of the actions whose column types
+/// are not specified can take seconds at the beginning of each event loop. With this cache, the code that is jitted
+/// before an event loop is compiled with optimizations into a shared library the first time, which is loaded instead
+/// of being jitted by subsequent runs of the same program. Libraries are named after the digest of their code, which
+/// includes the ROOT version, so they are rebuilt when the analysis or ROOT changes.
+///
+/// The expressions themselves are still declared to the interpreter when booking Filter and Define. If the code cannot
+/// be compiled outside of the interpreter, e.g. because an expression uses a function that was only declared with
+/// gInterpreter->Declare, it is just-in-time compiled as usual, and this is remembered in the directory for a day.
+/// Other failures to build the library, e.g. because the disk is full, are retried by the next run.
+/// This setting applies to all RDataFrames of the program.
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::EnableJitCache("rdfjitcache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Filter("x > 1").Histo1D("y"); // compiled the first time, loaded from rdfjitcache afterwards
+/// ~~~
+void EnableJitCache(std::string_view directory);
+
+/// \brief Limit the memory used by the datasets that RDataFrame::Cache keeps in memory.
+/// \param[in] maxBytes The maximum number of bytes of the columns of each cached dataset; 0 disables the limit.
+/// \param[in] spillDirectory The directory of the temporary files; an empty string selects the system default.
+///
+/// The budget is shared among the processing slots of the event loop that fills the cached dataset. Whenever the
+/// values cached by a slot take more memory than its share, they are appended to a temporary RNTuple file of the slot
+/// and their memory is released, so that the budget also holds while the dataset is filled. The values in the files
+/// are read back entry by entry, only for the columns that are used. The files are removed together with the cached
+/// dataset.
+/// This setting applies to the datasets cached afterwards. Columns can only be spilled if ROOT is built with RNTuple
+/// support and if RNTuple supports their type; other columns stay in memory.
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::SetCacheMemoryBudget(2ull << 30); // 2 GiB
+/// auto cached = df.Filter("pt > 20").Cache({"pt", "eta", "phi"});
+/// ~~~
+void SetCacheMemoryBudget(std::size_t maxBytes, std::string_view spillDirectory = "");
+
+/// \brief Measure the time spent in each node of the computation graph of an RDataFrame during its event loops
+/// \param[in] df Any node of the computation graph.
+/// \param[in] enable Whether the event loops are profiled.
+///
+/// During the profiled event loops, each Filter, Define and action records how many times it was evaluated and the
+/// time it took, with and without the upstream Filters and Defines it triggered (see RProfileReport). Each processing
+/// slot records the entries it processed, the bytes it read from the input files and the duration of its tasks.
+/// The report of the last event loop is returned by GetProfileReport(); it can be printed, or exported as JSON or as
+/// a trace that can be loaded in chrome://tracing or Perfetto.
+/// Profiling reads the clock twice per node evaluation, which slows down event loops with many cheap nodes.
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::EnableProfiling(df);
+/// auto h = df.Define("y", "x * x").Filter("y > 1").Histo1D("y");
+/// h->Draw();
+/// auto profile = ROOT::RDF::Experimental::GetProfileReport(df);
+/// profile.Print(); // the nodes, sorted by decreasing self time
+/// std::ofstream("trace.json") << profile.AsChromeTrace();
+/// ~~~
+void EnableProfiling(ROOT::RDF::RNode df, bool enable = true);
+
+/// \brief Enable the profiling of an RDataFrame, see EnableProfiling(ROOT::RDF::RNode, bool)
+void EnableProfiling(ROOT::RDataFrame df, bool enable = true);
+
+/// \brief Return the profile of the last event loop of an RDataFrame, see EnableProfiling(ROOT::RDF::RNode, bool)
+/// \param[in] df Any node of the computation graph.
+///
+/// The report is empty if profiling was not enabled.
+RProfileReport GetProfileReport(ROOT::RDF::RNode df);
+
+/// \brief Return the profile of the last event loop of an RDataFrame, see GetProfileReport(ROOT::RDF::RNode)
+RProfileReport GetProfileReport(ROOT::RDataFrame df);
+
 class ProgressBarAction;
 
 /// RDF progress helper.
@@ -74,6 +74,30 @@ public:
 
 namespace RDF {
 
+/// \brief A comparison of a data source column with a constant, e.g. `x > 3.5`.
+/// RDataFrame passes predicates to RDataSource::SetPushDownPredicates() if the result of the event loop only depends
+/// on the entries that pass them. The data source may then skip entries for which a predicate is certainly false.
+struct RColumnPredicate {
+   enum class EOp { kLess, kLessEqual, kGreater, kGreaterEqual, kEqual };
+
+   std::string fColumnName;
+   EOp fOp = EOp::kEqual;
+   double fValue = 0.0;
+
+   /// Whether there can be a value in the closed interval [min, max] for which the predicate holds
+   bool IsSatisfiable(double min, double max) const
+   {
+      switch (fOp) {
+      case EOp::kLess: return min < fValue;
+      case EOp::kLessEqual: return min <= fValue;
+      case EOp::kGreater: return max > fValue;
+      case EOp::kGreaterEqual: return max >= fValue;
+      case EOp::kEqual: return min <= fValue && fValue <= max;
+      }
+      return true;
+   }
+};
+
 // clang-format off
 /**
 \class ROOT::RDF::RDataSource
@@ -189,6 +213,15 @@ public:
    // clang-format on
    virtual bool SetEntry(unsigned int slot, ULong64_t entry) = 0;
 
+   // clang-format off
+   /// \brief Inform RDataSource of selections that can be applied before the entries reach RDataFrame.
+   /// \param[in] predicates Conditions that must all hold for an entry to be relevant; empty if there are none
+   /// Called before Initialize() at the start of every event-loop. Entries for which any of the predicates is false
+   /// can be skipped by returning false from SetEntry(); entries for which the data source cannot tell must be
+   /// processed. Returns *true* if the data source makes use of the predicates, *false* otherwise.
+   // clang-format on
+   virtual bool SetPushDownPredicates(const std::vector<RColumnPredicate> & /*predicates*/) { return false; }
+
    // clang-format off
    /// \brief Convenience method called before starting an event-loop.
    /// This method might be called multiple times over the lifetime of a RDataSource, since
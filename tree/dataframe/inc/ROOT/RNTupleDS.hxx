@@ -89,6 +89,30 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    /// onto slots.  In the InitSlot method, the column readers use this map to find the correct range to connect to.
    std::unordered_map<ULong64_t, std::size_t> fFirstEntry2RangeIdx;
 
+   /// Selections passed by RDataFrame that the data source applies itself, restricted to top-level arithmetic fields.
+   /// Entries in pages or clusters whose value range cannot satisfy a predicate are skipped in SetEntry().
+   std::vector<ROOT::RDF::RColumnPredicate> fPredicates;
+
+   /// The per-slot state required to evaluate the predicates in SetEntry()
+   struct RSlotState {
+      /// The page source the slot is connected to
+      Internal::RPageSource *fSource = nullptr;
+      /// Difference between the entry numbers seen by RDataFrame and the entry numbers in fSource
+      ULong64_t fEntryOffset = 0;
+      /// The physical column ID in fSource of the field of every predicate
+      std::vector<DescriptorId_t> fColumnIds;
+      /// The last decision of SetEntry() is valid for all the entries in [fWindowStart, fWindowEnd)
+      ULong64_t fWindowStart = 0;
+      ULong64_t fWindowEnd = 0;
+      bool fWindowPasses = true;
+   };
+   std::vector<RSlotState> fSlotStates;
+
+   /// Sets up the slot state for evaluating the predicates on the given range of fCurrentRanges
+   void ConnectSlotState(unsigned int slot, std::size_t idxRange, ULong64_t firstEntry);
+   /// Determines whether the entries around the given entry can satisfy the predicates and updates the slot window
+   void UpdateSlotWindow(RSlotState &state, ULong64_t entry);
+
    /// \brief Holds useful information about fields added to the RNTupleDS
    struct RFieldInfo {
       DescriptorId_t fFieldId;
@@ -131,6 +155,7 @@ public:
    std::string GetLabel() final { return "RNTupleDS"; }
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SetPushDownPredicates(const std::vector<ROOT::RDF::RColumnPredicate> &predicates) final;
 
    void Initialize() final;
    void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
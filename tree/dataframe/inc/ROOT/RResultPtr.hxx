@@ -14,6 +14,7 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "RtypesCore.h"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "TError.h" // Warning
 
@@ -443,6 +444,7 @@ template <typename T>
 RResultPtr<T>
 MakeResultPtr(const std::shared_ptr<T> &r, RLoopManager &lm, std::shared_ptr<RDFInternal::RActionBase> actionPtr)
 {
+   actionPtr->SetResultCacheIO(RDFInternal::MakeResultCacheIO(r));
    return RResultPtr<T>(r, &lm, std::move(actionPtr));
 }
 
@@ -10,6 +10,7 @@
 
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 #include "ROOT/RDF/Utils.hxx"
 
 using namespace ROOT::Internal::RDF;
@@ -23,3 +24,8 @@ RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() = default;
+
+void RActionBase::SetResultCacheIO(std::unique_ptr<RResultCacheIOBase> io)
+{
+   fResultCacheIO = std::move(io);
+}
@@ -0,0 +1,221 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h" // R__HAS_ROOT7
+#include "ROOT/RDF/RCacheDS.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/RLogger.hxx"
+#include "TString.h"
+#include "TSystem.h"
+
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleReader.hxx"
+#include "ROOT/RNTupleView.hxx"
+#include "ROOT/RNTupleWriteOptions.hxx"
+#include "ROOT/RNTupleWriter.hxx"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+const char *const kNTupleName = "cache";
+const std::string kFieldName = "column";
+
+std::size_t &GetMemoryBudget()
+{
+   static std::size_t budget = 0;
+   return budget;
+}
+
+std::string &GetSpillDirectory()
+{
+   static std::string directory;
+   return directory;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+void SetCacheMemoryBudget(std::size_t maxBytes, std::string_view spillDirectory)
+{
+   GetMemoryBudget() = maxBytes;
+   GetSpillDirectory() = std::string(spillDirectory);
+}
+
+std::size_t GetCacheMemoryBudget()
+{
+   return GetMemoryBudget();
+}
+
+const std::string &GetCacheSpillDirectory()
+{
+   return GetSpillDirectory();
+}
+
+struct RCacheSpillFile::RWriter {
+#ifdef R__HAS_ROOT7
+   std::unique_ptr<ROOT::Experimental::RNTupleWriter> fWriter;
+   std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+   /// The columns stored in the file and the tokens of their fields
+   std::vector<std::pair<std::size_t, ROOT::Experimental::REntry::RFieldToken>> fTokens;
+#endif
+};
+
+struct RCacheSpillFile::RSlotReader {
+   /// The address of the values of each column
+   std::vector<void *> fValuePtrs;
+#ifdef R__HAS_ROOT7
+   std::unique_ptr<ROOT::Experimental::RNTupleReader> fReader;
+   /// The view of each column, created the first time the column is loaded
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleView<void, true>>> fViews;
+#endif
+};
+
+RCacheSpillFile::RCacheSpillFile(const std::string &fileName, const std::vector<std::string> &typeNames)
+   : fFileName(fileName), fTypeNames(typeNames), fWriter(std::make_unique<RWriter>())
+{
+}
+
+RCacheSpillFile::~RCacheSpillFile()
+{
+   // close the writer and the readers before removing the file
+   fWriter.reset();
+   fSlotReaders.clear();
+   gSystem->Unlink(fFileName.c_str());
+}
+
+bool RCacheSpillFile::CanStore(const std::string &typeName)
+{
+#ifdef R__HAS_ROOT7
+   return ROOT::Experimental::RFieldBase::Check(kFieldName, typeName).empty();
+#else
+   (void)typeName;
+   return false;
+#endif
+}
+
+std::unique_ptr<RCacheSpillFile> RCacheSpillFile::Create(const std::string &directory,
+                                                         const std::vector<std::string> &typeNames,
+                                                         std::size_t maxBufferBytes)
+{
+#ifdef R__HAS_ROOT7
+   using ROOT::Experimental::RFieldBase;
+   using ROOT::Experimental::RNTupleModel;
+   using ROOT::Experimental::RNTupleWriteOptions;
+   using ROOT::Experimental::RNTupleWriter;
+
+   TString fileName("rdfcache");
+   FILE *file = gSystem->TempFileName(fileName, directory.empty() ? nullptr : directory.c_str(), ".root");
+   if (!file) {
+      R__LOG_WARNING(ROOT::Detail::RDF::RDFLogChannel())
+         << "Could not create a temporary file to spill cached columns, they are kept in memory.";
+      return nullptr;
+   }
+   fclose(file);
+
+   std::unique_ptr<RCacheSpillFile> spillFile(new RCacheSpillFile(fileName.Data(), typeNames));
+   try {
+      auto model = RNTupleModel::CreateBare();
+      for (std::size_t column = 0; column < typeNames.size(); ++column) {
+         if (!typeNames[column].empty())
+            model->AddField(RFieldBase::Create(kFieldName + std::to_string(column), typeNames[column]).Unwrap());
+      }
+      // the pages of a cluster are buffered in memory: keep them within the memory budget as well
+      RNTupleWriteOptions options;
+      if (maxBufferBytes > 0 && maxBufferBytes < options.GetApproxZippedClusterSize()) {
+         const auto clusterSize = std::max(maxBufferBytes, options.GetApproxUnzippedPageSize());
+         options.SetApproxZippedClusterSize(clusterSize);
+         options.SetMaxUnzippedClusterSize(clusterSize);
+      }
+      auto &writer = *spillFile->fWriter;
+      writer.fWriter = RNTupleWriter::Recreate(std::move(model), kNTupleName, fileName.Data(), options);
+      writer.fEntry = writer.fWriter->CreateEntry();
+      for (std::size_t column = 0; column < typeNames.size(); ++column) {
+         if (!typeNames[column].empty())
+            writer.fTokens.emplace_back(column, writer.fEntry->GetToken(kFieldName + std::to_string(column)));
+      }
+   } catch (const std::exception &e) {
+      R__LOG_WARNING(ROOT::Detail::RDF::RDFLogChannel())
+         << "Keeping cached columns in memory, they could not be spilled: " << e.what();
+      return nullptr;
+   }
+   return spillFile;
+#else
+   (void)directory;
+   (void)typeNames;
+   (void)maxBufferBytes;
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+      << "Cached columns cannot be spilled to disk, ROOT was built without RNTuple support.";
+   return nullptr;
+#endif
+}
+
+void RCacheSpillFile::Fill(const std::vector<void *> &valuePtrs)
+{
+#ifdef R__HAS_ROOT7
+   auto &writer = *fWriter;
+   for (const auto &[column, token] : writer.fTokens)
+      writer.fEntry->BindRawPtr<void>(token, valuePtrs[column]);
+   writer.fWriter->Fill(*writer.fEntry);
+#else
+   (void)valuePtrs;
+#endif
+   ++fNEntries;
+}
+
+void RCacheSpillFile::CommitWrite()
+{
+   fWriter.reset();
+}
+
+void RCacheSpillFile::BindSlot(unsigned int slot, std::size_t column, void *valuePtr)
+{
+   while (fSlotReaders.size() <= slot) {
+      fSlotReaders.emplace_back(std::make_unique<RSlotReader>());
+      fSlotReaders.back()->fValuePtrs.resize(fTypeNames.size(), nullptr);
+   }
+   fSlotReaders[slot]->fValuePtrs[column] = valuePtr;
+}
+
+void RCacheSpillFile::Load(unsigned int slot, std::size_t column, ULong64_t entry)
+{
+#ifdef R__HAS_ROOT7
+   auto &slotReader = *fSlotReaders[slot];
+   if (!slotReader.fReader) {
+      // the file is only opened by the slots that read its columns
+      slotReader.fReader = ROOT::Experimental::RNTupleReader::Open(kNTupleName, fFileName);
+      slotReader.fViews.resize(fTypeNames.size());
+   }
+   auto &view = slotReader.fViews[column];
+   if (!view) {
+      // the view reads into the value of the slot, which it does not own
+      std::shared_ptr<void> valuePtr(std::shared_ptr<void>(), slotReader.fValuePtrs[column]);
+      view = std::make_unique<ROOT::Experimental::RNTupleView<void, true>>(
+         slotReader.fReader->GetView<void>(kFieldName + std::to_string(column), valuePtr));
+   }
+   (*view)(entry);
+#else
+   (void)slot;
+   (void)column;
+   (void)entry;
+   throw std::logic_error("RCacheSpillFile: cached columns cannot be spilled without RNTuple support.");
+#endif
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
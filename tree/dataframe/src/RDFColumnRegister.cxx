@@ -122,6 +122,18 @@ std::vector<std::string> RColumnRegister::GetVariationsFor(const std::string &co
    return variations;
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Get the Vary nodes that directly provide alternative values for this column.
+std::vector<RVariationBase *> RColumnRegister::GetVariationNodesFor(const std::string &column) const
+{
+   std::vector<RVariationBase *> variations;
+   auto range = fVariations->equal_range(column);
+   for (auto it = range.first; it != range.second; ++it)
+      variations.emplace_back(&it->second->GetVariation());
+
+   return variations;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Get the names of all variations that directly or indirectly affect a given column.
 ///
@@ -14,6 +14,7 @@
 #include "TStopwatch.h"
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RDF/RCacheDS.hxx"     // for SetCacheMemoryBudget
 #include "ROOT/RDF/RLoopManager.hxx" // for RLoopManager
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RResultHandle.hxx"    // for RResultHandle, RunGraphs
@@ -384,6 +385,56 @@ void AddProgressBar(ROOT::RDataFrame dataframe)
    auto node = ROOT::RDF::AsRNode(dataframe);
    ROOT::RDF::Experimental::AddProgressBar(node);
 }
+
+void SetBulkSize(ROOT::RDF::RNode node, std::size_t bulkSize)
+{
+   ROOT::Internal::RDF::SetBulkSize(node, bulkSize);
+}
+
+void SetBulkSize(ROOT::RDataFrame dataframe, std::size_t bulkSize)
+{
+   ROOT::Internal::RDF::SetBulkSize(ROOT::RDF::AsRNode(dataframe), bulkSize);
+}
+
+void EnableResultCache(ROOT::RDF::RNode node, std::string_view directory, std::string_view tag)
+{
+   ROOT::Internal::RDF::SetResultCache(node, directory, tag);
+}
+
+void EnableResultCache(ROOT::RDataFrame dataframe, std::string_view directory, std::string_view tag)
+{
+   ROOT::Internal::RDF::SetResultCache(ROOT::RDF::AsRNode(dataframe), directory, tag);
+}
+
+void EnableJitCache(std::string_view directory)
+{
+   ROOT::Internal::RDF::SetJitCacheDirectory(directory);
+}
+
+void SetCacheMemoryBudget(std::size_t maxBytes, std::string_view spillDirectory)
+{
+   ROOT::Internal::RDF::SetCacheMemoryBudget(maxBytes, spillDirectory);
+}
+
+void EnableProfiling(ROOT::RDF::RNode node, bool enable)
+{
+   ROOT::Internal::RDF::SetProfiling(node, enable);
+}
+
+void EnableProfiling(ROOT::RDataFrame dataframe, bool enable)
+{
+   ROOT::Internal::RDF::SetProfiling(ROOT::RDF::AsRNode(dataframe), enable);
+}
+
+RProfileReport GetProfileReport(ROOT::RDF::RNode node)
+{
+   return ROOT::Internal::RDF::GetProfileReport(node);
+}
+
+RProfileReport GetProfileReport(ROOT::RDataFrame dataframe)
+{
+   return ROOT::Internal::RDF::GetProfileReport(ROOT::RDF::AsRNode(dataframe));
+}
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
@@ -27,6 +27,7 @@
 #include <TError.h>
 #include <TLeaf.h>
 #include <TObjArray.h>
+#include <TObjString.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
@@ -47,10 +48,12 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cerrno>
 #include <cstdlib>  // for size_t
 #include <iterator> // for back_insert_iterator
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -321,7 +324,7 @@ std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars,
    const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
                           "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + funcBaseName +
                           ")>::ret_type;\n}";
-   ROOT::Internal::RDF::InterpreterDeclare(toDeclare);
+   ROOT::Internal::RDF::InterpreterDeclare(toDeclare, funcFullName);
 
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
    exprMap.insert({funcCode, funcFullName});
@@ -361,6 +364,77 @@ ThrowJitBuildActionHelperTypeError(const std::string &actionTypeNameBase, const
    throw std::runtime_error(exceptionText);
 }
 
+/// Recognize jitted filter expressions of the form `column op number` or `number op column` with op one of <, <=, >,
+/// >=, ==. Only the original expression of a single column qualifies, e.g. `x > 2 && x < 5` does not.
+std::optional<ROOT::RDF::RColumnPredicate> ParseColumnPredicate(const ParsedExpression &parsedExpr)
+{
+   using EOp = ROOT::RDF::RColumnPredicate::EOp;
+
+   if (parsedExpr.fUsedCols.size() != 1)
+      return std::nullopt;
+
+   const std::string number = R"(([-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?))";
+   const std::string op = R"((<=|>=|==|<|>))";
+   const auto &var = parsedExpr.fVarNames[0];
+   TPRegexp colFirst("^\\s*" + var + "\\s*" + op + "\\s*" + number + "\\s*$");
+   TPRegexp numberFirst("^\\s*" + number + "\\s*" + op + "\\s*" + var + "\\s*$");
+
+   std::string opStr;
+   std::string valueStr;
+   bool isReversed = false;
+   const TString expr(parsedExpr.fExpr);
+   std::unique_ptr<TObjArray> groups(colFirst.MatchS(expr));
+   if (groups->GetEntriesFast() == 3) {
+      opStr = static_cast<TObjString *>(groups->At(1))->GetString().Data();
+      valueStr = static_cast<TObjString *>(groups->At(2))->GetString().Data();
+   } else {
+      groups.reset(numberFirst.MatchS(expr));
+      if (groups->GetEntriesFast() != 3)
+         return std::nullopt;
+      valueStr = static_cast<TObjString *>(groups->At(1))->GetString().Data();
+      opStr = static_cast<TObjString *>(groups->At(2))->GetString().Data();
+      isReversed = true;
+   }
+
+   // Literals such as 1e400 or 1e-400 compile but do not fit into a double: such filters are simply not pushed down
+   errno = 0;
+   const double value = std::strtod(valueStr.c_str(), nullptr);
+   if (errno == ERANGE)
+      return std::nullopt;
+
+   ROOT::RDF::RColumnPredicate predicate;
+   predicate.fColumnName = parsedExpr.fUsedCols[0];
+   predicate.fValue = value;
+   if (opStr == "==") {
+      predicate.fOp = EOp::kEqual;
+   } else if (opStr == "<") {
+      predicate.fOp = isReversed ? EOp::kGreater : EOp::kLess;
+   } else if (opStr == "<=") {
+      predicate.fOp = isReversed ? EOp::kGreaterEqual : EOp::kLessEqual;
+   } else if (opStr == ">") {
+      predicate.fOp = isReversed ? EOp::kLess : EOp::kGreater;
+   } else {
+      predicate.fOp = isReversed ? EOp::kLessEqual : EOp::kGreaterEqual;
+   }
+   return predicate;
+}
+
+/// Return a key that identifies a jitted Filter or Define by the function that evaluates it and by the nodes of the
+/// computation graph that provide its inputs, so that nodes with the same key compute the same values.
+std::string MakeJittedNodeKey(const std::string &funcName, const ColumnNames_t &usedCols,
+                              const ROOT::Internal::RDF::RColumnRegister &colRegister)
+{
+   using ROOT::Internal::RDF::PrettyPrintAddr;
+
+   std::string key = funcName;
+   for (const auto &col : usedCols) {
+      key += ' ' + col + ':' + PrettyPrintAddr(colRegister.GetDefine(col));
+      for (const auto *variation : colRegister.GetVariationNodesFor(col))
+         key += ',' + PrettyPrintAddr(variation);
+   }
+   return key;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -652,14 +726,27 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   // An unnamed filter identical to one already booked after the same node selects the same entries: reuse it.
+   // Named filters are excluded because each must appear in the cut-flow report.
+   auto *lm = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   std::string filterKey;
+   if (name.empty()) {
+      filterKey = PrettyPrintAddr(prevNodeOnHeap->get()) + ' ' +
+                  MakeJittedNodeKey(funcName, parsedExpr.fUsedCols, colRegister);
+      if (auto jittedFilter = lm->GetJittedFilter(filterKey)) {
+         delete prevNodeOnHeap; // no jitted call will use it
+         return jittedFilter;
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(colRegister);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
    const auto prevNodeAddr = PrettyPrintAddr(prevNodeOnHeap);
 
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
-      (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
-      Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+      lm, name, Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+   jittedFilter->SetExpression(expression);
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -681,7 +768,19 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
+   // Simple selections on data source columns of unnamed filters at the root of the graph can be offered to the
+   // data source, which may use them to skip entries (see RLoopManager::SetupPushDownPredicates()).
+   // Named filters are excluded because they must see all entries for their cut-flow report.
+   const bool isRootFilter = lm == prevNodeOnHeap->get();
+   if (ds && name.empty() && isRootFilter && jittedFilter->GetVariations().empty()) {
+      auto predicate = ParseColumnPredicate(parsedExpr);
+      if (predicate && !colRegister.IsDefineOrAlias(predicate->fColumnName) &&
+          IsStrInVec(predicate->fColumnName, dsColumns))
+         jittedFilter->SetPushDownPredicate(*predicate);
+   }
+
+   if (!filterKey.empty())
+      lm->AddJittedFilter(filterKey, jittedFilter);
    lm->ToJitExec(filterInvocation.str());
 
    return jittedFilter;
@@ -702,9 +801,18 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // A column with the same name and expression as one already booked, computed from the same inputs, has the same
+   // values: reuse it, e.g. when the same Define is booked in every iteration of a loop.
+   const auto defineKey = std::string(name) + ' ' + MakeJittedNodeKey(funcName, parsedExpr.fUsedCols, colRegister);
+   if (auto jittedDefine = lm.GetJittedDefine(defineKey)) {
+      delete upcastNodeOnHeap; // no jitted call will use it
+      return jittedDefine;
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
+   jittedDefine->SetExpression(expression);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefineTag>(" << funcName
@@ -726,6 +834,7 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                     << "), reinterpret_cast<std::shared_ptr<ROOT::Detail::RDF::RNodeBase>*>("
                     << PrettyPrintAddr(upcastNodeOnHeap) << "));\n";
 
+   lm.AddJittedDefine(defineKey, jittedDefine);
    lm.ToJitExec(defineInvocation.str());
    return jittedDefine;
 }
@@ -742,6 +851,7 @@ std::shared_ptr<RJittedDefine> BookDefinePerSampleJit(std::string_view name, std
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, retType, lm, colRegister, ColumnNames_t{});
+   jittedDefine->SetExpression(expression);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefinePerSampleTag>("
@@ -23,17 +23,110 @@
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <fstream>
+#include <map>
+#include <regex>
 #include <stdexcept>
 #include <string>
 #include <cstring>
+#include <ctime>
 #include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::RDF;
 
+namespace {
+/// The code declared with InterpreterDeclare under a name, which the code run by CompiledCalc may use.
+std::unordered_map<std::string, std::string> &GetNamedDeclarations()
+{
+   static std::unordered_map<std::string, std::string> declarations;
+   return declarations;
+}
+
+/// Collect the named declarations that the code refers to, sorted by name so that the digest of the
+/// compiled code does not depend on anything else declared in the program.
+std::string GetDeclarationsUsedBy(const std::string &code)
+{
+   static const std::regex identifierRegex("[A-Za-z_]\\w*(::[A-Za-z_]\\w*)*");
+   const auto &declarations = GetNamedDeclarations();
+   std::map<std::string, const std::string *> used;
+   for (std::sregex_iterator it(code.cbegin(), code.cend(), identifierRegex), end; it != end; ++it) {
+      const auto declIt = declarations.find(it->str());
+      if (declIt != declarations.end())
+         used.emplace(declIt->first, &declIt->second);
+   }
+   std::string result;
+   for (const auto &nameAndCode : used)
+      result.append(*nameAndCode.second).append("\n");
+   return result;
+}
+
+/// The directory of the shared libraries built by CompiledCalc, empty if disabled.
+std::string &GetJitCacheDir()
+{
+   static std::string directory;
+   return directory;
+}
+
+/// Seconds after which the marker of code that failed to compile expires and the compilation is tried again, since
+/// the failure might have been caused by the node rather than by the code, e.g. by a broken compiler installation.
+constexpr Long_t kFailedMarkerLifetime = 24 * 3600;
+
+/// The outcome of BuildSharedLibrary
+enum class EBuildStatus {
+   kOk,
+   kCompileError, ///< The compiler did not produce the object file, most likely because it rejected the code
+   kFailed        ///< Any other failure, e.g. of the link step or of the disk, that may not happen again
+};
+
+/// Build a shared library from a single source file, with the same build command as ACLiC but without dictionary.
+EBuildStatus BuildSharedLibrary(const std::string &source, const std::string &library)
+{
+   const TString buildDir = gSystem->GetDirName(library.c_str());
+   TString libName = gSystem->BaseName(library.c_str());
+   libName.Remove(libName.Last('.'));
+   TString object = source.c_str();
+   object.Remove(object.Last('.') + 1);
+   object += gSystem->GetObjExt();
+   const TString libs = TString(gSystem->GetLinkedLibs()) + " " + gSystem->GetLibraries("", "SDL");
+
+   TString cmd = gSystem->GetMakeSharedLib();
+   cmd.ReplaceAll("$SourceFiles", "\"" + TString(source.c_str()) + "\"");
+   cmd.ReplaceAll("$ObjectFiles", "\"" + object + "\"");
+   cmd.ReplaceAll("$IncludePath", gSystem->GetIncludePath());
+   cmd.ReplaceAll("$SharedLib", "\"" + TString(library.c_str()) + "\"");
+   cmd.ReplaceAll("$DepLibs", libs);
+   cmd.ReplaceAll("$LinkedLibs", libs);
+   cmd.ReplaceAll("$LibName", libName);
+   cmd.ReplaceAll("$BuildDir", "\"" + buildDir + "\"");
+   cmd.ReplaceAll("$Opt", gSystem->GetFlagsOpt());
+
+   R__LOG_DEBUG(10, RDFLogChannel()) << "Building the jitted code with:\n" << cmd;
+   const bool ok = gSystem->Exec(cmd.Data()) == 0 && !gSystem->AccessPathName(library.c_str());
+   const bool hasObject = !gSystem->AccessPathName(object);
+   gSystem->Unlink(object);
+   if (ok)
+      return EBuildStatus::kOk;
+   return hasObject ? EBuildStatus::kFailed : EBuildStatus::kCompileError;
+}
+
+/// Whether the marker of code that failed to compile exists and has not expired yet
+bool HasRecentFailedMarker(const std::string &marker)
+{
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(marker.c_str(), stat) != 0)
+      return false;
+   return std::time(nullptr) - stat.fMtime < kFailedMarkerLifetime;
+}
+} // anonymous namespace
+
 ROOT::Experimental::RLogChannel &ROOT::Detail::RDF::RDFLogChannel()
 {
    static ROOT::Experimental::RLogChannel c("ROOT.RDF");
@@ -312,7 +405,7 @@ std::vector<std::string> ReplaceDotWithUnderscore(const std::vector<std::string>
    return newColNames;
 }
 
-void InterpreterDeclare(const std::string &code)
+void InterpreterDeclare(const std::string &code, const std::string &name)
 {
    R__LOG_DEBUG(10, RDFLogChannel()) << "Declaring the following code to cling:\n\n" << code << '\n';
 
@@ -322,6 +415,104 @@ void InterpreterDeclare(const std::string &code)
          "the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid state.\n";
       throw std::runtime_error(msg);
    }
+
+   if (name.empty())
+      return;
+   R__LOCKGUARD(gROOTMutex);
+   GetNamedDeclarations()[name] = code;
+}
+
+void SetJitCacheDirectory(std::string_view directory)
+{
+   R__LOCKGUARD(gROOTMutex);
+   GetJitCacheDir() = directory;
+}
+
+bool CompiledCalc(const std::string &code, const std::string &context)
+{
+   std::string directory;
+   std::string declarations;
+   {
+      R__LOCKGUARD(gROOTMutex);
+      directory = GetJitCacheDir();
+      if (directory.empty())
+         return false;
+      declarations = GetDeclarationsUsedBy(code);
+   }
+
+   // The jitted code refers to the objects of the computation graph through their addresses, printed by
+   // PrettyPrintAddr as `(0x...)`. They change at every run: pass them as arguments of the compiled function instead.
+   static const std::regex addressRegex("\\((0x[0-9a-fA-F]+)\\)");
+   std::vector<ULong64_t> addresses;
+   std::string body;
+   auto last = code.cbegin();
+   for (std::sregex_iterator it(code.cbegin(), code.cend(), addressRegex), end; it != end; ++it) {
+      body.append(last, (*it)[0].first);
+      body += "(R_rdf_addresses[" + std::to_string(addresses.size()) + "])";
+      addresses.emplace_back(std::stoull((*it)[1].str(), nullptr, 16));
+      last = (*it)[0].second;
+   }
+   body.append(last, code.cend());
+
+   // The declarations go into an anonymous namespace, so that they do not clash with the ones known to cling
+   const std::string tu = "// ROOT " + std::string(gROOT->GetVersion()) + " " + gROOT->GetGitCommit() +
+                          "\n#include \"ROOT/RDataFrame.hxx\"\n#include \"TH2.h\"\n#include \"TH3.h\"\n"
+                          "#include \"TProfile.h\"\n#include \"TProfile2D.h\"\n#include \"TMath.h\"\n#include <cmath>\n"
+                          "namespace {\n" +
+                          declarations + "}\n";
+   const std::string funcSignature = "(const ULong64_t *R_rdf_addresses)\n{\n" + body + "\n}\n";
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(tu.data()), tu.size());
+   md5.Update(reinterpret_cast<const UChar_t *>(funcSignature.data()), funcSignature.size());
+   md5.Final();
+   const std::string funcName = std::string("R_rdf_compiled_") + md5.AsString();
+   const std::string library = directory + "/" + funcName + "." + gSystem->GetSoExt();
+   const std::string failedMarker = directory + "/" + funcName + ".failed";
+
+   if (HasRecentFailedMarker(failedMarker)) {
+      R__LOG_INFO(RDFLogChannel()) << "The jitted code of " << context << " recently failed to compile, see "
+                                   << failedMarker << "; it will be just-in-time compiled by the interpreter.";
+      return false;
+   }
+
+   if (gSystem->AccessPathName(library.c_str())) {
+      R__LOG_INFO(RDFLogChannel()) << "Compiling the jitted code of " << context << " into " << library << '.';
+      gSystem->mkdir(directory.c_str(), /*recursive=*/true);
+      // concurrent processes build their own copy, and atomically rename it once complete
+      const std::string tmpName = directory + "/" + funcName + "_" + std::to_string(gSystem->GetPid());
+      const std::string source = tmpName + ".cxx";
+      const std::string tmpLibrary = tmpName + "." + gSystem->GetSoExt();
+      bool written;
+      {
+         std::ofstream out(source);
+         out << tu << "extern \"C\" void " << funcName << funcSignature;
+         out.close();
+         written = !out.fail();
+      }
+      const auto status = written ? BuildSharedLibrary(source, tmpLibrary) : EBuildStatus::kFailed;
+      gSystem->Unlink(source.c_str());
+      if (status != EBuildStatus::kOk || gSystem->Rename(tmpLibrary.c_str(), library.c_str()) != 0) {
+         gSystem->Unlink(tmpLibrary.c_str());
+         R__LOG_WARNING(RDFLogChannel()) << "Could not compile the jitted code of " << context << " into " << library
+                                         << ", it will be just-in-time compiled by the interpreter.";
+         // e.g. the expressions use functions that were only declared to the interpreter: do not try again for a
+         // while. Other failures, such as a full disk, are retried by the next run.
+         if (status == EBuildStatus::kCompileError)
+            std::ofstream(failedMarker) << "ROOT " << gROOT->GetVersion() << " " << gROOT->GetGitCommit() << "\n";
+         return false;
+      }
+      gSystem->Unlink(failedMarker.c_str()); // an expired marker
+   }
+
+   if (gSystem->Load(library.c_str()) < 0)
+      return false;
+   auto func = reinterpret_cast<void (*)(const ULong64_t *)>(gSystem->DynFindSymbol("*", funcName.c_str()));
+   if (!func)
+      return false;
+
+   R__LOG_DEBUG(10, RDFLogChannel()) << "Executing the following code from " << library << ":\n\n" << code << '\n';
+   func(addresses.data());
+   return true;
 }
 
 Long64_t InterpreterCalc(const std::string &code, const std::string &context)
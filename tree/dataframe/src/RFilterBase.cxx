@@ -23,7 +23,7 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
      fLastCheckedEntry(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
      fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
-     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fColumnNames(columns),
+     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fBulkMasks(nSlots), fName(name), fColumnNames(columns),
      fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation)
 {
    const auto nColumns = fColumnNames.size();
@@ -51,11 +51,21 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
 {
    if (fName.empty()) // FillReport is no-op for unnamed filters
       return;
-   const auto accepted = std::accumulate(fAccepted.begin(), fAccepted.end(), 0ULL);
-   const auto all = accepted + std::accumulate(fRejected.begin(), fRejected.end(), 0ULL);
+   const auto accepted = GetAccepted();
+   const auto all = accepted + GetRejected();
    rep.AddCut({fName, accepted, all});
 }
 
+ULong64_t RFilterBase::GetAccepted() const
+{
+   return std::accumulate(fAccepted.begin(), fAccepted.end(), 0ULL);
+}
+
+ULong64_t RFilterBase::GetRejected() const
+{
+   return std::accumulate(fRejected.begin(), fRejected.end(), 0ULL);
+}
+
 void RFilterBase::InitNode()
 {
    if (!fName.empty()) // if this is a named filter we care about its report count
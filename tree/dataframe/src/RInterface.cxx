@@ -28,6 +28,51 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Sets the number of entries processed at a time by the nodes of an RDataFrame computation graph.
+ *
+ * \param node Any node of the computation graph.
+ * \param bulkSize The maximum number of entries per bulk; 0 or 1 process one entry at a time.
+ */
+void ROOT::Internal::RDF::SetBulkSize(const ROOT::RDF::RNode &node, std::size_t bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+/**
+ * \brief Enables the on-disk cache of the results of an RDataFrame computation graph.
+ *
+ * \param node Any node of the computation graph.
+ * \param directory The directory where results are stored; an empty string disables the cache.
+ * \param tag A string that is added to the keys of the results.
+ */
+void ROOT::Internal::RDF::SetResultCache(const ROOT::RDF::RNode &node, std::string_view directory,
+                                         std::string_view tag)
+{
+   node.GetLoopManager()->SetResultCache(directory, tag);
+}
+
+/**
+ * \brief Enables or disables the per-node profiling of the event loops of an RDataFrame computation graph.
+ *
+ * \param node Any node of the computation graph.
+ * \param enable Whether the event loops are profiled.
+ */
+void ROOT::Internal::RDF::SetProfiling(const ROOT::RDF::RNode &node, bool enable)
+{
+   node.GetLoopManager()->SetProfiling(enable);
+}
+
+/**
+ * \brief Returns the profile of the last event loop of an RDataFrame computation graph.
+ *
+ * \param node Any node of the computation graph.
+ */
+ROOT::RDF::Experimental::RProfileReport ROOT::Internal::RDF::GetProfileReport(const ROOT::RDF::RNode &node)
+{
+   return node.GetLoopManager()->GetProfileReport();
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
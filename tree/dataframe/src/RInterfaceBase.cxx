@@ -428,6 +428,8 @@ void ROOT::RDF::RInterfaceBase::AddDefaultColumns()
 
    auto entryColumn = std::make_shared<NewColEntry_t>(entryColName, entryColType, std::move(entryColGen),
                                                       ColumnNames_t{}, fColRegister, *fLoopManager);
+   // built-in columns are fully described by their name, e.g. in the key of the result cache
+   entryColumn->SetExpression(entryColName);
    fColRegister.AddDefine(std::move(entryColumn));
 
    // Slot number column
@@ -438,6 +440,7 @@ void ROOT::RDF::RInterfaceBase::AddDefaultColumns()
 
    auto slotColumn = std::make_shared<NewColSlot_t>(slotColName, slotColType, std::move(slotColGen), ColumnNames_t{},
                                                     fColRegister, *fLoopManager);
+   slotColumn->SetExpression(slotColName);
    fColRegister.AddDefine(std::move(slotColumn));
 
    fColRegister.AddAlias("tdfentry_", entryColName);
@@ -11,6 +11,7 @@
 #include "ROOT/RDF/RJittedAction.hxx"
 // Avoid error: invalid application of ‘sizeof’ to incomplete type in RJittedAction::GetMergeableValue
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 
 #include <cassert>
 #include <memory>
@@ -67,12 +68,31 @@ RJittedAction::RJittedAction(RLoopManager &lm, const ROOT::RDF::ColumnNames_t &c
 
 RJittedAction::~RJittedAction() {}
 
+void RJittedAction::SetAction(std::unique_ptr<RActionBase> a)
+{
+   // the result cache IO is set when booking the action, before jitting: hand it to the action that actually runs
+   a->SetResultCacheIO(std::move(fResultCacheIO));
+   fConcreteAction = std::move(a);
+}
+
 void RJittedAction::Run(unsigned int slot, Long64_t entry)
 {
    assert(fConcreteAction != nullptr);
    fConcreteAction->Run(slot, entry);
 }
 
+bool RJittedAction::SupportsBulk() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->SupportsBulk();
+}
+
+void RJittedAction::RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, firstEntry, bulkSize);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -125,6 +145,12 @@ void RJittedAction::SetHasRun()
    return fConcreteAction->SetHasRun();
 }
 
+std::string RJittedAction::GetActionName()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph(
    std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap)
 {
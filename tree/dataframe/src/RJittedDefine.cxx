@@ -51,6 +51,24 @@ void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
    fConcreteDefine->Update(slot, id);
 }
 
+bool RJittedDefine::SupportsBulk() const
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->SupportsBulk();
+}
+
+void RJittedDefine::UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask)
+{
+   assert(fConcreteDefine != nullptr);
+   fConcreteDefine->UpdateBulk(slot, mask);
+}
+
+void *RJittedDefine::GetBulkValuePtr(unsigned int slot)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetBulkValuePtr(slot);
+}
+
 void RJittedDefine::FinalizeSlot(unsigned int slot)
 {
    assert(fConcreteDefine != nullptr);
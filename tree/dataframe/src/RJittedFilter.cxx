@@ -44,7 +44,10 @@ void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
 {
    // the concrete filter has been registered with RLoopManager on creation, so let's deregister ourselves
    fLoopManager->Deregister(this);
+   f->SetExpression(fExpression);
    fConcreteFilter = std::move(f);
+   if (fPushDownPredicate)
+      fConcreteFilter->SetPushDownPredicate(*fPushDownPredicate);
 }
 
 void RJittedFilter::InitSlot(TTreeReader *r, unsigned int slot)
@@ -59,6 +62,13 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const ROOT::Internal::RDF::RMaskedEntryRange &
+RJittedFilter::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, firstEntry, bulkSize);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -14,12 +14,14 @@
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RDefineReader.hxx" // RDefinesWithReaders
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RDF/RVariationReader.hxx" // RVariationsWithReaders
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h" // Long64_t
+#include "RVersion.h"    // ROOT_RELEASE
 #include "TStopwatch.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
@@ -28,6 +30,7 @@
 #include "TFile.h"
 #include "TFriendElement.h"
 #include "TROOT.h" // IsImplicitMTEnabled, gCoreMutex, R__*_LOCKGUARD
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
 
@@ -53,6 +56,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -314,6 +318,44 @@ auto MakeDatasetColReadersKey(const std::string &colName, const std::type_info &
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+
+/// Describe the files read by the tree and its friends, for the key of the result cache.
+/// Files are identified by name, size and modification time. Return false if the files cannot be identified,
+/// e.g. for trees that only live in memory.
+bool DescribeTreeInputs(TTree &tree, std::ostream &key)
+{
+   std::vector<std::string> fileNames;
+   if (auto *chain = dynamic_cast<TChain *>(&tree)) {
+      for (auto *element : *chain->GetListOfFiles()) {
+         key << "chain element " << element->GetName() << '\n';
+         fileNames.emplace_back(element->GetTitle());
+      }
+   } else {
+      auto *file = tree.GetCurrentFile();
+      if (file == nullptr)
+         return false;
+      key << "tree " << ROOT::Internal::TreeUtils::GetTreeFullPaths(tree)[0] << '\n';
+      fileNames.emplace_back(file->GetName());
+   }
+
+   for (const auto &fileName : fileNames) {
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(fileName.c_str(), stat) != 0)
+         return false;
+      key << "file " << fileName << ' ' << stat.fSize << ' ' << stat.fMtime << '\n';
+   }
+
+   if (auto *friends = tree.GetListOfFriends()) {
+      for (auto *fr : *friends) {
+         auto *friendElement = static_cast<TFriendElement *>(fr);
+         auto *friendTree = friendElement->GetTree();
+         key << "friend " << friendElement->GetName() << '\n';
+         if (friendTree == nullptr || !DescribeTreeInputs(*friendTree, key))
+            return false;
+      }
+   }
+   return true;
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -353,7 +395,7 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots), fBulkStates(fNSlots)
 {
 }
 
@@ -364,7 +406,7 @@ RLoopManager::RLoopManager(std::unique_ptr<TTree> tree, const ColumnNames_t &def
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots), fBulkStates(fNSlots)
 {
 }
 
@@ -374,14 +416,14 @@ RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots), fBulkStates(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots), fBulkStates(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -391,7 +433,7 @@ RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
-     fDatasetColumnReaders(fNSlots)
+     fDatasetColumnReaders(fNSlots), fBulkStates(fNSlots)
 {
    ChangeSpec(std::move(spec));
 }
@@ -479,8 +521,9 @@ void RLoopManager::RunEmptySourceMT()
       try {
          UpdateSampleInfo(slot, range);
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+            ProcessEntry(slot, currEntry);
          }
+         FlushBulk(slot);
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -505,8 +548,9 @@ void RLoopManager::RunEmptySource()
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
       for (ULong64_t currEntry = fEmptyEntryRange.first;
            currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+         ProcessEntry(0, currEntry);
       }
+      FlushBulk(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -540,10 +584,12 @@ void RLoopManager::RunTreeProcessorMT()
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
+               FlushBulk(slot);
                UpdateSampleInfo(slot, r);
             }
-            RunAndCheckFilters(slot, count++);
+            ProcessEntry(slot, count++);
          }
+         FlushBulk(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -581,10 +627,12 @@ void RLoopManager::RunTreeReader()
    try {
       while (r.Next() && fNStopsReceived < fNChildren) {
          if (fNewSampleNotifier.CheckFlag(0)) {
+            FlushBulk(0);
             UpdateSampleInfo(/*slot*/0, r);
          }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
+         ProcessEntry(0, r.GetCurrentEntry());
       }
+      FlushBulk(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -613,10 +661,11 @@ void RLoopManager::RunDataSource()
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+                  ProcessEntry(0u, entry);
                }
             }
          }
+         FlushBulk(0u);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -648,9 +697,10 @@ void RLoopManager::RunDataSourceMT()
       try {
          for (auto entry = start; entry < end; ++entry) {
             if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+               ProcessEntry(slot, entry);
             }
          }
+         FlushBulk(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -668,23 +718,87 @@ void RLoopManager::RunDataSourceMT()
 #endif // not implemented otherwise (never called)
 }
 
+/// Process one entry of the dataset: either run the computation graph on it right away or, in bulk processing mode,
+/// add it to the bulk of entries of this slot.
+void RLoopManager::ProcessEntry(unsigned int slot, Long64_t entry)
+{
+   if (fProfiler)
+      fProfiler->CountEntry(slot);
+   if (fBulkStates[slot].fIsEnabled)
+      StageBulkEntry(slot, entry);
+   else
+      RunAndCheckFilters(slot, entry);
+}
+
 /// Execute actions and make sure named filters are called for each event.
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
    // data-block callbacks run before the rest of the graph
+   RunDataBlockCallbacks(slot);
+
+   for (auto *actionPtr : fBookedActions) {
+      RDFInternal::RNodeProfiler::RScope profile(fProfiler.get(), slot, actionPtr);
+      actionPtr->Run(slot, entry);
+   }
+   for (auto *namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFilters(slot, entry);
+   for (auto &callback : fCallbacksEveryNEvents)
+      callback(slot);
+}
+
+void RLoopManager::RunDataBlockCallbacks(unsigned int slot)
+{
    if (fNewSampleNotifier.CheckFlag(slot)) {
       for (auto &callback : fSampleCallbacks)
          callback.second(slot, fSampleInfos[slot]);
       fNewSampleNotifier.UnsetFlag(slot);
    }
+}
 
-   for (auto *actionPtr : fBookedActions)
-      actionPtr->Run(slot, entry);
+/// Add the current entry to the bulk of entries of this slot.
+/// Only consecutive entries are processed together: the bulk is flushed before a gap in the entry numbers and
+/// whenever it is full. The dataset column readers copy the values of the current entry, as the next entry overwrites
+/// them before the bulk is processed.
+void RLoopManager::StageBulkEntry(unsigned int slot, Long64_t entry)
+{
+   auto &state = fBulkStates[slot];
+   if (state.fNEntries > 0 && entry != state.fFirstEntry + static_cast<Long64_t>(state.fNEntries))
+      FlushBulk(slot);
+   if (state.fNEntries == 0) {
+      // data-block callbacks run before the rest of the graph sees the entries of the new bulk
+      RunDataBlockCallbacks(slot);
+      state.fFirstEntry = entry;
+   }
+   for (auto *reader : state.fReaders)
+      reader->StageBulkEntry(entry, state.fNEntries, fBulkSize);
+   if (++state.fNEntries == fBulkSize)
+      FlushBulk(slot);
+}
+
+/// Run the computation graph on the bulk of entries collected by this slot, if any.
+void RLoopManager::FlushBulk(unsigned int slot)
+{
+   auto &state = fBulkStates[slot];
+   if (!state.fIsEnabled || state.fNEntries == 0)
+      return;
+
+   const auto firstEntry = state.fFirstEntry;
+   const auto bulkSize = state.fNEntries;
+   state.fMask.Reset(firstEntry, bulkSize);
+   // reset the state first: if a node throws, the entries of this bulk must not be processed again
+   state.fNEntries = 0;
+
+   for (auto *actionPtr : fBookedActions) {
+      RDFInternal::RNodeProfiler::RScope profile(fProfiler.get(), slot, actionPtr);
+      actionPtr->RunBulk(slot, firstEntry, bulkSize);
+   }
    for (auto *namedFilterPtr : fBookedNamedFilters)
-      namedFilterPtr->CheckFilters(slot, entry);
-   for (auto &callback : fCallbacksEveryNEvents)
-      callback(slot);
+      namedFilterPtr->CheckFiltersBulk(slot, firstEntry, bulkSize);
+   for (auto &callback : fCallbacksEveryNEvents) {
+      for (std::size_t i = 0; i < bulkSize; ++i)
+         callback(slot);
+   }
 }
 
 /// Build TTreeReaderValues for all nodes
@@ -692,18 +806,71 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->BeginTask(slot, r);
    SetupSampleCallbacks(r, slot);
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedFilters)
       ptr->InitSlot(r, slot);
-   for (auto *ptr : fBookedDefines)
+   for (auto *ptr : fActiveDefines)
       ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedVariations)
       ptr->InitSlot(r, slot);
 
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+
+   InitBulkState(slot);
+}
+
+/// Decide whether the task about to run on this slot processes entries in bulks, and collect the column readers that
+/// need to stage their values.
+void RLoopManager::InitBulkState(unsigned int slot)
+{
+   auto &state = fBulkStates[slot];
+   state.fNEntries = 0;
+   state.fFirstEntry = -1;
+   state.fMask.Invalidate();
+   state.fReaders.clear();
+   state.fIsEnabled = CanRunBulk(slot);
+   if (!state.fIsEnabled)
+      return;
+
+   for (auto &colAndReader : fDatasetColumnReaders[slot]) {
+      if (colAndReader.second != nullptr)
+         state.fReaders.emplace_back(colAndReader.second.get());
+   }
+}
+
+/// Bulk processing is only possible if all nodes in the computation graph and all dataset column readers support it.
+bool RLoopManager::CanRunBulk(unsigned int slot) const
+{
+   if (fBulkSize < 2)
+      return false;
+
+   const auto fallBack = [](const std::string &reason) {
+      R__LOG_DEBUG(0, RDFLogChannel()) << "Bulk processing disabled: " << reason << '.';
+      return false;
+   };
+   if (!fBookedRanges.empty())
+      return fallBack("the computation graph contains Range nodes");
+   if (!fBookedVariations.empty())
+      return fallBack("the computation graph contains systematic variations");
+   for (auto *ptr : fActiveDefines) {
+      if (!ptr->SupportsBulk())
+         return fallBack("column \"" + ptr->GetName() + "\" does not support bulk processing");
+   }
+   for (auto *ptr : fBookedActions) {
+      if (!ptr->SupportsBulk())
+         return fallBack("the computation graph contains actions that do not support bulk processing");
+   }
+   for (auto &colAndReader : fDatasetColumnReaders[slot]) {
+      // readers of tree columns that are not used in this event loop are null
+      if (colAndReader.second != nullptr && !colAndReader.second->CanStageBulk())
+         return fallBack("the values of column \"" + colAndReader.first + "\" cannot be staged");
+   }
+   return true;
 }
 
 void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
@@ -755,6 +922,84 @@ void RLoopManager::InitNodes()
       range->InitNode();
    for (auto *ptr : fBookedActions)
       ptr->Initialize();
+   SetupActiveDefines();
+
+   if (fProfiler) {
+      // jitted filters forward the evaluation to the concrete filter, which is booked too
+      std::vector<RFilterBase *> filters;
+      for (auto *filter : fBookedFilters) {
+         if (dynamic_cast<RJittedFilter *>(filter) == nullptr)
+            filters.emplace_back(filter);
+      }
+      fProfiler->BeginLoop(filters, fActiveDefines, fBookedActions);
+   }
+}
+
+/// Select the Defines whose values are read in this event loop, i.e. by the booked actions, by the filters and
+/// variations, or by other Defines that are read in turn. The others are skipped by InitNodeSlots(), so that neither
+/// they nor the readers of their input columns are created.
+/// Columns are matched by name, which is conservative: a Define is kept if any column with the same name is read.
+void RLoopManager::SetupActiveDefines()
+{
+   std::unordered_set<std::string> readColumns;
+   const auto addColumns = [&readColumns](const ColumnNames_t &columns,
+                                          const RDFInternal::RColumnRegister &colRegister) {
+      for (const auto &col : columns) {
+         readColumns.insert(col);
+         readColumns.insert(std::string(colRegister.ResolveAlias(col)));
+      }
+   };
+   for (auto *ptr : fBookedActions)
+      addColumns(ptr->GetColumnNames(), ptr->GetColRegister());
+   for (auto *ptr : fBookedFilters)
+      addColumns(ptr->GetColumnNames(), ptr->GetColRegister());
+   for (auto *ptr : fBookedVariations)
+      addColumns(ptr->GetInputColumns(), ptr->GetColRegister());
+
+   // Defines that are read add their own inputs, which can make other Defines active
+   std::unordered_set<RDefineBase *> activeDefines;
+   bool done = false;
+   while (!done) {
+      done = true;
+      for (auto *ptr : fBookedDefines) {
+         if (activeDefines.count(ptr) == 0 && readColumns.count(ptr->GetName()) > 0) {
+            activeDefines.insert(ptr);
+            addColumns(ptr->GetColumnNames(), ptr->GetColRegister());
+            done = false;
+         }
+      }
+   }
+
+   // keep the booking order
+   fActiveDefines.clear();
+   for (auto *ptr : fBookedDefines) {
+      if (activeDefines.count(ptr) > 0)
+         fActiveDefines.emplace_back(ptr);
+   }
+   if (fActiveDefines.size() < fBookedDefines.size()) {
+      R__LOG_DEBUG(0, RDFLogChannel()) << "Skipping " << fBookedDefines.size() - fActiveDefines.size()
+                                       << " Defines that are not read in event loop number " << fNRuns << '.';
+   }
+}
+
+/// Offer the data source the selection of the filter that decides on all the entries of the event loop, if any.
+/// Entries skipped by the data source are not seen by any node, so this is only possible if such a filter is the
+/// only active child of the loop manager and no callback depends on the number of processed entries.
+void RLoopManager::SetupPushDownPredicates()
+{
+   if (!fDataSource)
+      return;
+
+   std::vector<ROOT::RDF::RColumnPredicate> predicates;
+   if (fNChildren == 1 && fCallbacksEveryNEvents.empty() && fSampleCallbacks.empty()) {
+      for (auto *filter : fBookedFilters) {
+         if (const auto *predicate = filter->GetPushDownPredicate()) {
+            predicates.emplace_back(*predicate);
+            break;
+         }
+      }
+   }
+   fDataSource->SetPushDownPredicates(predicates);
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -765,6 +1010,7 @@ void RLoopManager::CleanUpNodes()
    // forget RActions and detach TResultProxies
    for (auto *ptr : fBookedActions)
       ptr->Finalize();
+   UpdateResultCache();
 
    fRunActions.insert(fRunActions.begin(), fBookedActions.begin(), fBookedActions.end());
    fBookedActions.clear();
@@ -779,18 +1025,21 @@ void RLoopManager::CleanUpNodes()
 
    fCallbacksEveryNEvents.clear();
    fCallbacksOnce.clear();
+   fActiveDefines.clear();
 }
 
 /// Perform clean-up operations. To be called at the end of each task execution.
 void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->EndTask(slot, r);
    if (r != nullptr)
       fNewSampleNotifier.GetChainNotifyLink(slot).RemoveLink(*r->GetTree());
    for (auto *ptr : fBookedActions)
       ptr->FinalizeSlot(slot);
    for (auto *ptr : fBookedFilters)
       ptr->FinalizeSlot(slot);
-   for (auto *ptr : fBookedDefines)
+   for (auto *ptr : fActiveDefines)
       ptr->FinalizeSlot(slot);
 
    if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
@@ -820,7 +1069,8 @@ void RLoopManager::Jit()
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   if (!RDFInternal::CompiledCalc(code, "RLoopManager::Run"))
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
@@ -857,6 +1107,7 @@ void RLoopManager::Run(bool jit)
       Jit();
 
    InitNodes();
+   SetupPushDownPredicates();
 
    // Exceptions can occur during the event loop. In order to ensure proper cleanup of nodes
    // we use RAII: even in case of an exception, the destructor of the object is invoked and
@@ -874,15 +1125,25 @@ void RLoopManager::Run(bool jit)
    TStopwatch s;
    s.Start();
 
-   switch (fLoopType) {
-   case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
-   case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
-   case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
-   case ELoopType::kNoFiles: RunEmptySource(); break;
-   case ELoopType::kROOTFiles: RunTreeReader(); break;
-   case ELoopType::kDataSource: RunDataSource(); break;
+   if (ReadCachedResults()) {
+      R__LOG_INFO(RDFLogChannel()) << "Results of event loop number " << fNRuns << " read from the result cache in "
+                                   << fResultCache->GetDirectory() << '.';
+   } else {
+      switch (fLoopType) {
+      case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
+      case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
+      case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
+      case ELoopType::kNoFiles: RunEmptySource(); break;
+      case ELoopType::kROOTFiles: RunTreeReader(); break;
+      case ELoopType::kDataSource: RunDataSource(); break;
+      }
+      // the results are written to the cache after finalization, see CleanUpNodes()
+      if (!fResultCacheKey.empty())
+         fResultCacheStatus = EResultCacheStatus::kMustWrite;
    }
    s.Stop();
+   if (fProfiler)
+      fProfiler->EndLoop();
 
    fNRuns++;
 
@@ -939,6 +1200,38 @@ void RLoopManager::Deregister(RRangeBase *rangePtr)
    RDFInternal::Erase(rangePtr, fBookedRanges);
 }
 
+std::shared_ptr<RJittedDefine> RLoopManager::GetJittedDefine(const std::string &key)
+{
+   auto it = fJittedDefines.find(key);
+   if (it == fJittedDefines.end())
+      return nullptr;
+   auto define = it->second.lock();
+   if (!define)
+      fJittedDefines.erase(it); // the branch of the computation graph that used it went out of scope
+   return define;
+}
+
+void RLoopManager::AddJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define)
+{
+   fJittedDefines[key] = define;
+}
+
+std::shared_ptr<RJittedFilter> RLoopManager::GetJittedFilter(const std::string &key)
+{
+   auto it = fJittedFilters.find(key);
+   if (it == fJittedFilters.end())
+      return nullptr;
+   auto filter = it->second.lock();
+   if (!filter)
+      fJittedFilters.erase(it);
+   return filter;
+}
+
+void RLoopManager::AddJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter)
+{
+   fJittedFilters[key] = filter;
+}
+
 void RLoopManager::Register(RDefineBase *ptr)
 {
    fBookedDefines.emplace_back(ptr);
@@ -947,6 +1240,7 @@ void RLoopManager::Register(RDefineBase *ptr)
 void RLoopManager::Deregister(RDefineBase *ptr)
 {
    RDFInternal::Erase(ptr, fBookedDefines);
+   RDFInternal::Erase(ptr, fActiveDefines);
    fSampleCallbacks.erase(ptr);
 }
 
@@ -1118,6 +1412,140 @@ void RLoopManager::SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange
    fEmptyEntryRange = std::move(newRange);
 }
 
+/// Enable the on-disk cache of the results of the event loops, or disable it if the directory is empty.
+void RLoopManager::SetResultCache(std::string_view directory, std::string_view tag)
+{
+   if (directory.empty())
+      fResultCache.reset();
+   else
+      fResultCache = std::make_unique<RDFInternal::RResultCache>(directory, tag);
+}
+
+/// Enable or disable the per-node profiling of the event loops, see ROOT::RDF::Experimental::EnableProfiling().
+void RLoopManager::SetProfiling(bool enable)
+{
+   if (!enable)
+      fProfiler.reset();
+   else if (!fProfiler)
+      fProfiler = std::make_unique<RDFInternal::RNodeProfiler>(fNSlots);
+}
+
+/// Return the profile of the last event loop, empty if profiling is disabled.
+ROOT::RDF::Experimental::RProfileReport RLoopManager::GetProfileReport() const
+{
+   return fProfiler ? fProfiler->GetReport() : ROOT::RDF::Experimental::RProfileReport();
+}
+
+/// Build the key of the results of the event loop that is about to run, or return an empty string if they cannot be
+/// cached. The key describes the input dataset, all nodes of the computation graph including the expressions of
+/// jitted nodes, and the initial state of the results (e.g. the histogram models).
+/// The code of compiled Filters and Defines and of custom actions cannot be part of the key: their results are only
+/// cached if the user provided a tag, which stands for that code.
+std::string RLoopManager::MakeResultCacheKey() const
+{
+   if (fBookedActions.empty())
+      return "";
+
+   const auto notCacheable = [](const std::string &reason) {
+      R__LOG_INFO(RDFLogChannel()) << "The results of this event loop are not cached: " << reason << '.';
+      return std::string();
+   };
+   if (fDataSource)
+      return notCacheable("the input dataset is read through an RDataSource");
+   if (!fBookedVariations.empty())
+      return notCacheable("the computation graph contains systematic variations");
+
+   std::stringstream key;
+   key << "ROOT " << ROOT_RELEASE << '\n';
+   key << "tag " << fResultCache->GetTag() << '\n';
+
+   if (fTree) {
+      if (!DescribeTreeInputs(*fTree, key))
+         return notCacheable("the input files cannot be identified");
+      key << "entries " << fBeginEntry << ' ' << fEndEntry << '\n';
+      if (auto *entryList = fTree->GetEntryList())
+         key << "entry list " << RDFInternal::SerializeObject(*entryList) << '\n';
+   } else {
+      key << "empty source " << fEmptyEntryRange.first << ' ' << fEmptyEntryRange.second << '\n';
+   }
+
+   bool runsUserCode = false;
+   for (auto *define : fBookedDefines) {
+      key << "define " << define->GetName() << ' ' << define->GetTypeName();
+      for (const auto &col : define->GetColumnNames())
+         key << ' ' << col;
+      key << " = " << define->GetExpression() << '\n';
+      runsUserCode |= define->GetExpression().empty();
+   }
+   for (auto *filter : fBookedFilters) {
+      key << "filter " << filter->GetName();
+      for (const auto &col : filter->GetColumnNames())
+         key << ' ' << col;
+      key << " : " << filter->GetExpression() << '\n';
+      runsUserCode |= filter->GetExpression().empty();
+   }
+   for (auto *range : fBookedRanges)
+      key << "range " << range->GetStart() << ' ' << range->GetStop() << ' ' << range->GetStride() << '\n';
+
+   for (auto *action : fBookedActions) {
+      const auto *io = action->GetResultCacheIO();
+      if (io == nullptr)
+         return notCacheable("the computation graph contains actions whose results cannot be stored");
+      runsUserCode |= action->RunsUserCode();
+      key << "action";
+      for (const auto &col : action->GetColumnNames())
+         key << ' ' << col;
+      // the branch of the computation graph this action belongs to, from the action up to the root
+      std::unordered_map<void *, std::shared_ptr<RDFInternal::GraphDrawing::GraphNode>> visitedMap;
+      const auto actionNode = action->GetGraph(visitedMap);
+      for (const auto *node = actionNode.get(); node != nullptr; node = node->GetPrevNode())
+         key << " <- " << node->GetName();
+      key << '\n' << io->Serialize() << '\n';
+   }
+
+   if (runsUserCode && fResultCache->GetTag().empty())
+      return notCacheable("the computation graph contains compiled Filters or Defines or custom actions, pass a tag "
+                          "to EnableResultCache() that identifies their code to cache the results");
+   return key.str();
+}
+
+/// Read the results of the event loop that is about to run from the result cache, if enabled.
+/// Return true if all results were found: they are applied after the actions are finalized, see UpdateResultCache().
+bool RLoopManager::ReadCachedResults()
+{
+   fResultCacheStatus = EResultCacheStatus::kNone;
+   fResultCacheKey = fResultCache ? MakeResultCacheKey() : "";
+   if (fResultCacheKey.empty())
+      return false;
+
+   std::vector<RDFInternal::RResultCacheIOBase *> results;
+   for (auto *action : fBookedActions)
+      results.emplace_back(action->GetResultCacheIO());
+   if (!fResultCache->Read(fResultCacheKey, results))
+      return false;
+   fResultCacheStatus = EResultCacheStatus::kHit;
+   return true;
+}
+
+/// Apply the results read from the result cache or write the results of the event loop that just ran to it.
+void RLoopManager::UpdateResultCache()
+{
+   if (fResultCacheStatus != EResultCacheStatus::kNone) {
+      std::vector<RDFInternal::RResultCacheIOBase *> results;
+      for (auto *action : fBookedActions)
+         results.emplace_back(action->GetResultCacheIO());
+      if (fResultCacheStatus == EResultCacheStatus::kHit) {
+         for (auto *result : results)
+            result->Apply();
+      } else if (!fResultCache->Write(fResultCacheKey, results)) {
+         R__LOG_WARNING(RDFLogChannel()) << "Could not write the results of the event loop to the result cache in "
+                                         << fResultCache->GetDirectory() << '.';
+      }
+   }
+   fResultCacheStatus = EResultCacheStatus::kNone;
+   fResultCacheKey.clear();
+}
+
 /**
  * \brief Helper function to open a file (or the first file from a glob).
  * This function is used at construction time of an RDataFrame, to check the
@@ -26,10 +26,12 @@
 #include <TError.h>
 #include <TSystem.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <typeinfo>
 #include <utility>
@@ -454,10 +456,113 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    return reader;
 }
 
-bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
+bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   // Old API, unsused
-   return true;
+   // The column readers are positioned by the entry number passed to them; here we only apply the predicates
+   if (fPredicates.empty())
+      return true;
+
+   auto &state = fSlotStates[slot];
+   if (!state.fSource)
+      return true;
+   if (entry < state.fWindowStart || entry >= state.fWindowEnd)
+      UpdateSlotWindow(state, entry);
+   return state.fWindowPasses;
+}
+
+bool RNTupleDS::SetPushDownPredicates(const std::vector<ROOT::RDF::RColumnPredicate> &predicates)
+{
+   static const std::unordered_set<std::string> kSignedTypes = {"std::int8_t", "std::int16_t", "std::int32_t",
+                                                                "std::int64_t", "float", "double"};
+   static const std::unordered_set<std::string> kUnsignedTypes = {"std::uint8_t", "std::uint16_t", "std::uint32_t",
+                                                                  "std::uint64_t"};
+
+   fPredicates.clear();
+   for (const auto &p : predicates) {
+      // Only top-level fields have one element per entry
+      const auto fieldId = fPrincipalDescriptor->FindFieldId(p.fColumnName, fPrincipalDescriptor->GetFieldZeroId());
+      if (fieldId == kInvalidDescriptorId)
+         continue;
+      const auto &fieldDesc = fPrincipalDescriptor->GetFieldDescriptor(fieldId);
+      const auto typeName = fieldDesc.GetTypeName();
+      if (fieldDesc.GetStructure() != ENTupleStructure::kLeaf || fieldDesc.GetNRepetitions() > 0)
+         continue;
+      if (kSignedTypes.count(typeName) == 0 && kUnsignedTypes.count(typeName) == 0)
+         continue;
+      // In C++, comparing a 32bit or 64bit unsigned integer with a negative constant converts the constant to unsigned
+      if (kUnsignedTypes.count(typeName) > 0 && p.fValue < 0 && typeName != "std::uint8_t" &&
+          typeName != "std::uint16_t")
+         continue;
+      fPredicates.emplace_back(p);
+   }
+   return !fPredicates.empty();
+}
+
+void RNTupleDS::ConnectSlotState(unsigned int slot, std::size_t idxRange, ULong64_t firstEntry)
+{
+   auto &state = fSlotStates[slot];
+   state = RSlotState();
+   if (fPredicates.empty())
+      return;
+
+   const auto &range = fCurrentRanges[idxRange];
+   state.fSource = range.fSource.get();
+   state.fEntryOffset = firstEntry - range.fFirstEntry;
+   auto descriptorGuard = state.fSource->GetSharedDescriptorGuard();
+   for (const auto &p : fPredicates) {
+      const auto fieldId = descriptorGuard->FindFieldId(p.fColumnName, descriptorGuard->GetFieldZeroId());
+      const auto columnId =
+         (fieldId == kInvalidDescriptorId) ? kInvalidDescriptorId : descriptorGuard->FindPhysicalColumnId(fieldId, 0);
+      state.fColumnIds.emplace_back(columnId);
+   }
+}
+
+void RNTupleDS::UpdateSlotWindow(RSlotState &state, ULong64_t entry)
+{
+   const auto localEntry = entry - state.fEntryOffset;
+   // By default, the decision only holds for this entry
+   state.fWindowStart = entry;
+   state.fWindowEnd = entry + 1;
+   state.fWindowPasses = true;
+
+   auto descriptorGuard = state.fSource->GetSharedDescriptorGuard();
+   for (std::size_t i = 0; i < fPredicates.size(); ++i) {
+      const auto columnId = state.fColumnIds[i];
+      if (columnId == kInvalidDescriptorId)
+         continue;
+      const auto clusterId = descriptorGuard->FindClusterId(columnId, localEntry);
+      if (clusterId == kInvalidDescriptorId)
+         continue;
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+      const auto &columnRange = clusterDesc.GetColumnRange(columnId);
+
+      // For top-level fields, the element index equals the entry index
+      ULong64_t start = columnRange.fFirstElementIndex;
+      ULong64_t end = start + columnRange.fNElements;
+      auto valueRange = columnRange.fValueRange;
+      if (!valueRange || fPredicates[i].IsSatisfiable(valueRange->fMin, valueRange->fMax)) {
+         // The cluster as a whole may match; try to narrow down the decision to the page
+         const auto pageInfo = clusterDesc.GetPageRange(columnId).Find(localEntry - columnRange.fFirstElementIndex);
+         start += pageInfo.fFirstInPage;
+         end = start + pageInfo.fNElements;
+         valueRange = pageInfo.fValueRange;
+      }
+
+      if (valueRange && !fPredicates[i].IsSatisfiable(valueRange->fMin, valueRange->fMax)) {
+         state.fWindowStart = start + state.fEntryOffset;
+         state.fWindowEnd = end + state.fEntryOffset;
+         state.fWindowPasses = false;
+         return;
+      }
+      // The entry passes for this predicate in [start, end); the combined window is the intersection
+      if (i == 0) {
+         state.fWindowStart = start + state.fEntryOffset;
+         state.fWindowEnd = end + state.fEntryOffset;
+      } else {
+         state.fWindowStart = std::max(state.fWindowStart, start + state.fEntryOffset);
+         state.fWindowEnd = std::min(state.fWindowEnd, end + state.fEntryOffset);
+      }
+   }
 }
 
 void RNTupleDS::PrepareNextRanges()
@@ -609,6 +714,7 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
       for (auto r : fActiveColumnReaders[0]) {
          r->Connect(*fCurrentRanges[0].fSource, ranges[0].first);
       }
+      ConnectSlotState(0, 0, ranges[0].first);
    }
 
    return ranges;
@@ -623,6 +729,7 @@ void RNTupleDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
    for (auto r : fActiveColumnReaders[slot]) {
       r->Connect(*fCurrentRanges[idxRange].fSource, firstEntry - fCurrentRanges[idxRange].fFirstEntry);
    }
+   ConnectSlotState(slot, idxRange, firstEntry);
 }
 
 void RNTupleDS::FinalizeSlot(unsigned int slot)
@@ -633,6 +740,7 @@ void RNTupleDS::FinalizeSlot(unsigned int slot)
    for (auto r : fActiveColumnReaders[slot]) {
       r->Disconnect(true /* keepValue */);
    }
+   fSlotStates[slot] = RSlotState();
 }
 
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
@@ -661,6 +769,7 @@ void RNTupleDS::Initialize()
 
 void RNTupleDS::Finalize()
 {
+   std::fill(fSlotStates.begin(), fSlotStates.end(), RSlotState());
    for (unsigned int i = 0; i < fNSlots; ++i) {
       for (auto r : fActiveColumnReaders[i]) {
          r->Disconnect(false /* keepValue */);
@@ -674,6 +783,7 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    assert(nSlots > 0);
    fNSlots = nSlots;
    fActiveColumnReaders.resize(fNSlots);
+   fSlotStates.resize(fNSlots);
 }
 } // namespace Experimental
 } // namespace ROOT
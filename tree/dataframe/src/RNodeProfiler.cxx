@@ -0,0 +1,194 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNodeProfiler.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RFilterBase.hxx"
+#include "TFile.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+
+#include <algorithm>
+
+namespace {
+double ToSeconds(Long64_t nanoseconds)
+{
+   return nanoseconds * 1e-9;
+}
+
+TFile *GetCurrentFile(TTreeReader *r)
+{
+   return (r != nullptr && r->GetTree() != nullptr) ? r->GetTree()->GetCurrentFile() : nullptr;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RNodeProfiler::RNodeProfiler(unsigned int nSlots) : fSlots(nSlots) {}
+
+void RNodeProfiler::AddNode(const void *node, const std::string &kind, const std::string &name)
+{
+   fNodeIndices.emplace(node, fReport.fNodes.size());
+   fReport.fNodes.emplace_back();
+   fReport.fNodes.back().fKind = kind;
+   fReport.fNodes.back().fName = name;
+   fFilters.emplace_back(nullptr);
+   fFilterCountsAtStart.emplace_back(0ull, 0ull);
+}
+
+/// Register the nodes that take part in the event loop and reset all statistics.
+void RNodeProfiler::BeginLoop(const std::vector<ROOT::Detail::RDF::RFilterBase *> &filters,
+                              const std::vector<ROOT::Detail::RDF::RDefineBase *> &defines,
+                              const std::vector<RActionBase *> &actions)
+{
+   fReport = ROOT::RDF::Experimental::RProfileReport();
+   fNodeIndices.clear();
+   fFilters.clear();
+   fFilterCountsAtStart.clear();
+
+   for (auto *filter : filters) {
+      AddNode(filter, "Filter", filter->GetName());
+      // the counts of unnamed filters are never reset, and the ones of named filters only for reports
+      fFilters.back() = filter;
+      fFilterCountsAtStart.back() = {filter->GetAccepted(), filter->GetRejected()};
+   }
+   for (auto *define : defines)
+      AddNode(define, "Define", define->GetName());
+   for (auto *action : actions)
+      AddNode(action, "Action", action->GetActionName());
+
+   for (auto &slot : fSlots) {
+      slot = RSlotData();
+      slot.fNodes.resize(fReport.fNodes.size());
+   }
+   fLoopStart = Clock_t::now();
+}
+
+void RNodeProfiler::EndLoop()
+{
+   fReport.fTime = std::chrono::duration<double>(Clock_t::now() - fLoopStart).count();
+
+   for (std::size_t i = 0; i < fReport.fNodes.size(); ++i) {
+      auto &node = fReport.fNodes[i];
+      Long64_t totalTime = 0;
+      Long64_t selfTime = 0;
+      for (const auto &slot : fSlots) {
+         node.fCalls += slot.fNodes[i].fCalls;
+         totalTime += slot.fNodes[i].fTotalTime;
+         selfTime += slot.fNodes[i].fSelfTime;
+      }
+      node.fTotalTime = ToSeconds(totalTime);
+      node.fSelfTime = ToSeconds(selfTime);
+      if (fFilters[i] != nullptr) {
+         node.fPass = fFilters[i]->GetAccepted() - fFilterCountsAtStart[i].first;
+         node.fAll = node.fPass + fFilters[i]->GetRejected() - fFilterCountsAtStart[i].second;
+      }
+   }
+
+   for (unsigned int i = 0; i < fSlots.size(); ++i) {
+      const auto &slot = fSlots[i];
+      ROOT::RDF::Experimental::RSlotProfile slotProfile;
+      slotProfile.fSlot = i;
+      slotProfile.fNTasks = slot.fNTasks;
+      slotProfile.fEntries = slot.fEntries;
+      slotProfile.fBytesRead = slot.fBytesRead;
+      slotProfile.fTime = ToSeconds(slot.fTime);
+      fReport.fSlots.emplace_back(std::move(slotProfile));
+   }
+
+   std::sort(fReport.fTasks.begin(), fReport.fTasks.end(),
+             [](const ROOT::RDF::Experimental::RTaskProfile &a, const ROOT::RDF::Experimental::RTaskProfile &b) {
+                return a.fStart < b.fStart;
+             });
+}
+
+void RNodeProfiler::BeginTask(unsigned int slot, TTreeReader *r)
+{
+   auto &data = fSlots[slot];
+   data.fStack.clear();
+   data.fTaskFirstEntry = data.fEntries;
+   data.fTaskSelfTimes.resize(data.fNodes.size());
+   for (std::size_t i = 0; i < data.fNodes.size(); ++i)
+      data.fTaskSelfTimes[i] = data.fNodes[i].fSelfTime;
+   // With a single slot, all reads happen in this slot, also the ones of the files of a chain that are closed during
+   // the task. Otherwise the bytes read from the file of the task are counted.
+   data.fTaskFile = GetCurrentFile(r);
+   if (fSlots.size() == 1)
+      data.fTaskBytesAtStart = TFile::GetFileBytesRead();
+   else
+      data.fTaskBytesAtStart = data.fTaskFile ? data.fTaskFile->GetBytesRead() : 0;
+   data.fTaskStart = Clock_t::now();
+}
+
+void RNodeProfiler::EndTask(unsigned int slot, TTreeReader *r)
+{
+   const auto end = Clock_t::now();
+   auto &data = fSlots[slot];
+
+   ROOT::RDF::Experimental::RTaskProfile task;
+   task.fSlot = slot;
+   task.fStart = std::chrono::duration<double>(data.fTaskStart - fLoopStart).count();
+   task.fDuration = std::chrono::duration<double>(end - data.fTaskStart).count();
+   task.fEntries = data.fEntries - data.fTaskFirstEntry;
+
+   auto *file = GetCurrentFile(r);
+   if (fSlots.size() == 1) {
+      task.fBytesRead = TFile::GetFileBytesRead() - data.fTaskBytesAtStart;
+   } else if (file != nullptr) {
+      // a file opened during the task was not read before
+      task.fBytesRead = file->GetBytesRead() - (file == data.fTaskFile ? data.fTaskBytesAtStart : 0);
+   }
+   if (file != nullptr)
+      task.fInput = file->GetName();
+
+   for (std::size_t i = 0; i < data.fNodes.size(); ++i) {
+      const auto selfTime = data.fNodes[i].fSelfTime - data.fTaskSelfTimes[i];
+      if (selfTime > 0)
+         task.fNodeTimes.emplace_back(i, ToSeconds(selfTime));
+   }
+
+   ++data.fNTasks;
+   data.fBytesRead += task.fBytesRead;
+   data.fTime += std::chrono::duration_cast<std::chrono::nanoseconds>(end - data.fTaskStart).count();
+
+   std::lock_guard<std::mutex> lock(fTasksMutex);
+   fReport.fTasks.emplace_back(std::move(task));
+}
+
+void RNodeProfiler::Enter(unsigned int slot, const void *node)
+{
+   const auto it = fNodeIndices.find(node);
+   const auto index = it == fNodeIndices.end() ? kUnknownNode : it->second;
+   fSlots[slot].fStack.push_back({index, Clock_t::now(), 0});
+}
+
+void RNodeProfiler::Exit(unsigned int slot)
+{
+   const auto end = Clock_t::now();
+   auto &stack = fSlots[slot].fStack;
+   const auto frame = stack.back();
+   stack.pop_back();
+
+   const Long64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - frame.fStart).count();
+   if (frame.fNode != kUnknownNode) {
+      auto &times = fSlots[slot].fNodes[frame.fNode];
+      ++times.fCalls;
+      times.fTotalTime += elapsed;
+      times.fSelfTime += elapsed - frame.fChildTime;
+   }
+   // the time of nodes that are not registered stays in the self time of the enclosing node
+   if (!stack.empty())
+      stack.back().fChildTime += frame.fNode != kUnknownNode ? elapsed : frame.fChildTime;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,152 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string escaped;
+   for (const char c : str) {
+      switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            escaped += buf;
+         } else {
+            escaped += c;
+         }
+      }
+   }
+   return escaped;
+}
+
+std::string GetNodeLabel(const ROOT::RDF::Experimental::RNodeProfile &node)
+{
+   return node.fName.empty() ? node.fKind : node.fKind + " " + node.fName;
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+const RNodeProfile &RProfileReport::At(std::string_view name) const
+{
+   auto it = std::find_if(fNodes.begin(), fNodes.end(), [&name](const RNodeProfile &n) { return n.fName == name; });
+   if (it == fNodes.end())
+      throw std::runtime_error("Cannot find a node called \"" + std::string(name) + "\" in the profile report.");
+   return *it;
+}
+
+void RProfileReport::Print() const
+{
+   std::vector<std::size_t> order(fNodes.size());
+   std::iota(order.begin(), order.end(), 0);
+   std::stable_sort(order.begin(), order.end(),
+                    [this](std::size_t a, std::size_t b) { return fNodes[a].fSelfTime > fNodes[b].fSelfTime; });
+
+   Printf("Event loop: %.3f s", fTime);
+   for (const auto i : order) {
+      const auto &node = fNodes[i];
+      if (node.fKind == "Filter") {
+         Printf("%-6s %-30s: self=%-10.4f total=%-10.4f calls=%-10lld pass=%-10lld all=%-10lld", node.fKind.c_str(),
+                node.fName.c_str(), node.fSelfTime, node.fTotalTime, node.fCalls, node.fPass, node.fAll);
+      } else {
+         Printf("%-6s %-30s: self=%-10.4f total=%-10.4f calls=%-10lld", node.fKind.c_str(), node.fName.c_str(),
+                node.fSelfTime, node.fTotalTime, node.fCalls);
+      }
+   }
+   for (const auto &slot : fSlots) {
+      Printf("Slot %-4u: tasks=%-6u entries=%-12lld bytes read=%-14lld time=%.3f s", slot.fSlot, slot.fNTasks,
+             slot.fEntries, slot.fBytesRead, slot.fTime);
+   }
+}
+
+/// Return the report as a JSON object with a "nodes", a "slots" and a "tasks" array. Times are in seconds.
+std::string RProfileReport::AsJSON() const
+{
+   std::ostringstream os;
+   os.precision(9);
+   os << "{\"time\": " << fTime << ",\n \"nodes\": [";
+   for (std::size_t i = 0; i < fNodes.size(); ++i) {
+      const auto &node = fNodes[i];
+      os << (i == 0 ? "\n" : ",\n") << "  {\"kind\": \"" << node.fKind << "\", \"name\": \"" << EscapeJSON(node.fName)
+         << "\", \"calls\": " << node.fCalls << ", \"selfTime\": " << node.fSelfTime
+         << ", \"totalTime\": " << node.fTotalTime;
+      if (node.fKind == "Filter")
+         os << ", \"pass\": " << node.fPass << ", \"all\": " << node.fAll;
+      os << '}';
+   }
+   os << "],\n \"slots\": [";
+   for (std::size_t i = 0; i < fSlots.size(); ++i) {
+      const auto &slot = fSlots[i];
+      os << (i == 0 ? "\n" : ",\n") << "  {\"slot\": " << slot.fSlot << ", \"tasks\": " << slot.fNTasks
+         << ", \"entries\": " << slot.fEntries << ", \"bytesRead\": " << slot.fBytesRead << ", \"time\": " << slot.fTime
+         << '}';
+   }
+   os << "],\n \"tasks\": [";
+   for (std::size_t i = 0; i < fTasks.size(); ++i) {
+      const auto &task = fTasks[i];
+      os << (i == 0 ? "\n" : ",\n") << "  {\"slot\": " << task.fSlot << ", \"start\": " << task.fStart
+         << ", \"duration\": " << task.fDuration << ", \"entries\": " << task.fEntries
+         << ", \"bytesRead\": " << task.fBytesRead << ", \"input\": \"" << EscapeJSON(task.fInput) << "\"}";
+   }
+   os << "]}\n";
+   return os.str();
+}
+
+/// Return the report in the trace event format, with one thread per processing slot and one event per task.
+/// The events of the nodes of a task are laid out one after the other inside the task, with their self time as
+/// duration: their order does not reflect the order of evaluation, which is interleaved entry by entry.
+std::string RProfileReport::AsChromeTrace() const
+{
+   std::ostringstream os;
+   os.precision(12);
+   bool first = true;
+   const auto addEvent = [&](const std::string &name, const char *category, unsigned int slot, double start,
+                             double duration, const std::string &args) {
+      os << (first ? "\n" : ",\n") << "  {\"name\": \"" << EscapeJSON(name) << "\", \"cat\": \"" << category
+         << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << slot << ", \"ts\": " << start * 1e6
+         << ", \"dur\": " << duration * 1e6 << ", \"args\": {" << args << "}}";
+      first = false;
+   };
+
+   os << "{\"traceEvents\": [";
+   for (const auto &task : fTasks) {
+      std::ostringstream args;
+      args << "\"entries\": " << task.fEntries << ", \"bytesRead\": " << task.fBytesRead << ", \"input\": \""
+           << EscapeJSON(task.fInput) << '"';
+      addEvent("Task", "task", task.fSlot, task.fStart, task.fDuration, args.str());
+      double nodeStart = task.fStart;
+      for (const auto &nodeAndTime : task.fNodeTimes) {
+         addEvent(GetNodeLabel(fNodes[nodeAndTime.first]), "node", task.fSlot, nodeStart, nodeAndTime.second, "");
+         nodeStart += nodeAndTime.second;
+      }
+   }
+   os << "],\n \"displayTimeUnit\": \"ms\"}\n";
+   return os.str();
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
@@ -0,0 +1,162 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RResultCache.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/RLogger.hxx"
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TFile.h"
+#include "TMD5.h"
+#include "TObjString.h"
+#include "TParameter.h"
+#include "TSystem.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+const char *const kKeyName = "key";
+
+std::string GetResultName(std::size_t idx)
+{
+   return "result" + std::to_string(idx);
+}
+
+template <typename T>
+bool WriteParameter(TDirectory &dir, const std::string &name, T value)
+{
+   TParameter<T> par(name.c_str(), value);
+   return dir.WriteTObject(&par, name.c_str()) > 0;
+}
+
+template <typename T>
+bool ReadParameter(TDirectory &dir, const std::string &name, T &value)
+{
+   std::unique_ptr<TParameter<T>> par(dir.Get<TParameter<T>>(name.c_str()));
+   if (!par)
+      return false;
+   value = par->GetVal();
+   return true;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+std::string SerializeObject(const TObject &obj)
+{
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObject(&obj);
+   // hex-encode the streamed bytes: the key is text and must not contain e.g. null characters
+   static constexpr char kHexDigits[] = "0123456789abcdef";
+   std::string hex;
+   hex.reserve(2 * buf.Length());
+   for (Int_t i = 0; i < buf.Length(); ++i) {
+      const auto byte = static_cast<unsigned char>(buf.Buffer()[i]);
+      hex += kHexDigits[byte >> 4];
+      hex += kHexDigits[byte & 0xf];
+   }
+   return hex;
+}
+
+void DetachFromDirectory(TObject &obj)
+{
+   // e.g. TH1::DirectoryAutoAdd, which calls SetDirectory
+   if (auto addToDirectory = obj.IsA()->GetDirectoryAutoAdd())
+      addToDirectory(&obj, nullptr);
+}
+
+bool WriteValue(TDirectory &dir, const std::string &name, Long64_t value)
+{
+   return WriteParameter(dir, name, value);
+}
+
+bool WriteValue(TDirectory &dir, const std::string &name, Double_t value)
+{
+   return WriteParameter(dir, name, value);
+}
+
+bool ReadValue(TDirectory &dir, const std::string &name, Long64_t &value)
+{
+   return ReadParameter(dir, name, value);
+}
+
+bool ReadValue(TDirectory &dir, const std::string &name, Double_t &value)
+{
+   return ReadParameter(dir, name, value);
+}
+
+RResultCache::RResultCache(std::string_view directory, std::string_view tag) : fDirectory(directory), fTag(tag) {}
+
+std::string RResultCache::GetFileName(const std::string &key) const
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   return fDirectory + "/" + md5.AsString() + ".root";
+}
+
+bool RResultCache::Read(const std::string &key, const std::vector<RResultCacheIOBase *> &results) const
+{
+   const auto fileName = GetFileName(key);
+   if (gSystem->AccessPathName(fileName.c_str()))
+      return false; // not cached yet
+
+   std::unique_ptr<TFile> file(TFile::Open(fileName.c_str(), "READ"));
+   if (!file || file->IsZombie())
+      return false;
+   std::unique_ptr<TObjString> storedKey(file->Get<TObjString>(kKeyName));
+   // compare the full strings: a comparison with key.c_str() would stop at the first null character
+   if (!storedKey || std::string_view(storedKey->GetString().Data(), storedKey->GetString().Length()) != key) {
+      R__LOG_WARNING(ROOT::Detail::RDF::RDFLogChannel())
+         << "Ignoring the result cache file " << fileName << ", which was written for a different key.";
+      return false;
+   }
+   for (std::size_t i = 0; i < results.size(); ++i) {
+      if (!results[i]->Read(*file, GetResultName(i))) {
+         R__LOG_WARNING(ROOT::Detail::RDF::RDFLogChannel())
+            << "Could not read " << GetResultName(i) << " from the result cache file " << fileName << '.';
+         return false;
+      }
+   }
+   return true;
+}
+
+bool RResultCache::Write(const std::string &key, const std::vector<RResultCacheIOBase *> &results) const
+{
+   gSystem->mkdir(fDirectory.c_str(), /*recursive=*/true);
+   const auto fileName = GetFileName(key);
+   const auto tmpFileName = fileName + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   {
+      std::unique_ptr<TFile> file(TFile::Open(tmpFileName.c_str(), "RECREATE"));
+      if (!file || file->IsZombie())
+         return false;
+      TObjString storedKey;
+      storedKey.String() = TString(key.data(), key.size());
+      bool ok = file->WriteTObject(&storedKey, kKeyName) > 0;
+      for (std::size_t i = 0; ok && i < results.size(); ++i)
+         ok = results[i]->Write(*file, GetResultName(i));
+      file->Close();
+      if (!ok) {
+         gSystem->Unlink(tmpFileName.c_str());
+         return false;
+      }
+   }
+   if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+      gSystem->Unlink(tmpFileName.c_str());
+      return false;
+   }
+   return true;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
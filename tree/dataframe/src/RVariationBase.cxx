@@ -47,6 +47,16 @@ const std::vector<std::string> &RVariationBase::GetColumnNames() const
    return fColNames;
 }
 
+const ColumnNames_t &RVariationBase::GetInputColumns() const
+{
+   return fInputColumns;
+}
+
+const RColumnRegister &RVariationBase::GetColRegister() const
+{
+   return fColumnRegister;
+}
+
 const std::vector<std::string> &RVariationBase::GetVariationNames() const
 {
    return fVariationNames;
@@ -1,13 +1,20 @@
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
 #include "ROOT/TSeq.hxx"
 #include "ROOT/RTrivialDS.hxx"
 #include "TH1F.h"
 #include "TRandom.h"
 #include "TSystem.h"
 
+#ifdef R__HAS_ROOT7
+#include "ROOT/RNTupleReader.hxx"
+#endif
+
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <numeric>
 
 using namespace ROOT::RDF;
 using namespace ROOT::VecOps;
@@ -336,3 +343,60 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+// Return the names of the files that RDataFrame::Cache spilled its columns to in the directory
+std::vector<std::string> GetSpillFiles(const char *directory)
+{
+   std::vector<std::string> files;
+   void *dir = gSystem->OpenDirectory(directory);
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (TString(entry).BeginsWith("rdfcache"))
+         files.emplace_back(std::string(directory) + "/" + entry);
+   }
+   gSystem->FreeDirectory(dir);
+   return files;
+}
+
+TEST(Cache, MemoryBudget)
+{
+   const auto spillDirectory = "dataframe_cache_MemoryBudget";
+   gSystem->mkdir(spillDirectory);
+   {
+      // a budget of one byte spills all the columns that can be spilled, entry after entry
+      ROOT::RDF::Experimental::SetCacheMemoryBudget(1, spillDirectory);
+      ROOT::RDataFrame df(100);
+      auto cached = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                       .Define("v", [](ULong64_t e) { return std::vector<float>(e % 3, e); }, {"rdfentry_"})
+                       .Define("b", [](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"})
+                       .Define("unused", [] { return 42.; })
+                       .Cache<int, std::vector<float>, bool, double>({"x", "v", "b", "unused"});
+      ROOT::RDF::Experimental::SetCacheMemoryBudget(0);
+
+      auto sumx = cached.Sum<int>("x");
+      auto sumElements = [](const std::vector<float> &v) { return std::accumulate(v.begin(), v.end(), 0.); };
+      auto sumv = cached.Define("sumv", sumElements, {"v"}).Sum<double>("sumv");
+      auto nb = cached.Filter([](bool b) { return b; }, {"b"}).Count();
+      EXPECT_EQ(*sumx, 4950);
+      EXPECT_DOUBLE_EQ(*sumv, 4917.);
+      EXPECT_EQ(*nb, 50ull);
+
+#ifdef R__HAS_ROOT7
+      // all the entries of the columns but the bool one went to the spill file while the columns were filled
+      const auto spillFiles = GetSpillFiles(spillDirectory);
+      ASSERT_EQ(spillFiles.size(), 1u);
+      auto reader = ROOT::Experimental::RNTupleReader::Open("cache", spillFiles[0]);
+      EXPECT_EQ(reader->GetNEntries(), 100u);
+      const auto &descriptor = reader->GetDescriptor();
+      for (auto field : {"column0", "column1", "column3"})
+         EXPECT_NE(descriptor.FindFieldId(field), ROOT::Experimental::kInvalidDescriptorId) << field;
+      EXPECT_EQ(descriptor.FindFieldId("column2"), ROOT::Experimental::kInvalidDescriptorId);
+#endif
+
+      // values are read again from the spilled columns
+      EXPECT_EQ(*cached.Sum<int>("x"), 4950);
+      EXPECT_EQ(*cached.Max<double>("unused"), 42.);
+   }
+   // the spill files are removed together with the cached dataset
+   EXPECT_TRUE(GetSpillFiles(spillDirectory).empty());
+   gSystem->Unlink(spillDirectory);
+}
@@ -4,6 +4,7 @@
 #include <ROOT/RVec.hxx>
 #include <ROOT/RDFHelpers.hxx>
 #include <ROOT/RResultHandle.hxx>
+#include <TInterpreter.h>
 #include <TSystem.h>
 #include <RConfigure.h>
 
@@ -753,6 +754,150 @@ TEST(RDFHelpers, Cleanup_After_Exception)
       << "The Finalize method should have changed the value of testVal during the post-exception cleanup." << std::endl;
 }
 
+TEST(RDFHelpers, SetBulkSize)
+{
+   // book the same computation graph with and without bulk processing and compare the results
+   auto book = [](ROOT::RDF::RNode df) {
+      auto filtered = df.Define("x", [](ULong64_t e) { return double(e % 17); }, {"rdfentry_"})
+                         .Filter([](double x) { return x > 3.; }, {"x"}, "xcut")
+                         .Define("y", [](double x, ULong64_t e) { return x * (e % 3); }, {"x", "rdfentry_"})
+                         .Filter([](double y) { return y < 20.; }, {"y"}, "ycut");
+      auto count = filtered.Count();
+      auto sum = filtered.Sum<double>("y");
+      auto entries = filtered.Take<ULong64_t>("rdfentry_");
+      auto h = filtered.Histo1D<double, double>({"h", "h", 20, 0., 20.}, "x", "y");
+      auto report = df.Report();
+      return std::make_tuple(count, sum, entries, h, report);
+   };
+   auto check = [&](ROOT::RDF::RNode ref, ROOT::RDF::RNode bulk) {
+      auto refRes = book(ref);
+      ROOT::RDF::Experimental::SetBulkSize(bulk, 16);
+      auto bulkRes = book(bulk);
+      EXPECT_EQ(*std::get<0>(refRes), *std::get<0>(bulkRes));
+      EXPECT_DOUBLE_EQ(*std::get<1>(refRes), *std::get<1>(bulkRes));
+      EXPECT_EQ(*std::get<2>(refRes), *std::get<2>(bulkRes));
+      EXPECT_DOUBLE_EQ(std::get<3>(refRes)->GetEntries(), std::get<3>(bulkRes)->GetEntries());
+      for (int bin = 0; bin <= 21; ++bin)
+         EXPECT_DOUBLE_EQ(std::get<3>(refRes)->GetBinContent(bin), std::get<3>(bulkRes)->GetBinContent(bin));
+      for (const auto &cut : {"xcut", "ycut"}) {
+         EXPECT_EQ(std::get<4>(refRes)->At(cut).GetPass(), std::get<4>(bulkRes)->At(cut).GetPass());
+         EXPECT_EQ(std::get<4>(refRes)->At(cut).GetAll(), std::get<4>(bulkRes)->At(cut).GetAll());
+      }
+   };
+
+   check(ROOT::RDataFrame(1000), ROOT::RDataFrame(1000));
+
+   const auto fname = "dataframe_helpers_setbulksize.root";
+   ROOT::RDataFrame(1000).Define("z", [](ULong64_t e) { return int(e); }, {"rdfentry_"}).Snapshot<int>("t", fname, {"z"});
+   {
+      ROOT::RDataFrame ref("t", fname);
+      ROOT::RDataFrame bulk("t", fname);
+      check(ref.Filter([](int z) { return z % 5 != 0; }, {"z"}), bulk.Filter([](int z) { return z % 5 != 0; }, {"z"}));
+   }
+   gSystem->Unlink(fname);
+}
+
+TEST(RDFHelpers, EnableResultCache)
+{
+   const auto fname = "dataframe_helpers_resultcache.root";
+   const auto cacheDir = "dataframe_helpers_resultcache";
+   ROOT::RDataFrame(100).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Snapshot<double>("t", fname, {"x"});
+
+   unsigned int nCalls = 0;
+   auto run = [&](double cut, int nBins, const std::string &tag = "v1") {
+      ROOT::RDataFrame df("t", fname);
+      ROOT::RDF::Experimental::EnableResultCache(df, cacheDir, tag);
+      auto filtered = df.Define("y", [&nCalls](double x) { ++nCalls; return 2. * x; }, {"x"})
+                         .Filter("x > " + std::to_string(cut));
+      auto count = filtered.Count();
+      auto sum = filtered.Sum<double>("y");
+      auto h = filtered.Histo1D<double>({"h", "h", nBins, 0., 200.}, "y");
+      return std::make_tuple(*count, *sum, h->GetEntries(), h->GetNbinsX(), h->GetBinContent(1));
+   };
+
+   const auto first = run(9.5, 10);
+   EXPECT_EQ(nCalls, 90u);
+   EXPECT_EQ(std::get<0>(first), 90ull);
+
+   // same computation graph on the same input: the results are read from the cache
+   const auto second = run(9.5, 10);
+   EXPECT_EQ(nCalls, 90u);
+   EXPECT_EQ(first, second);
+
+   // a different jitted expression or histogram model invalidates the cached results
+   const auto third = run(49.5, 10);
+   EXPECT_EQ(nCalls, 140u);
+   EXPECT_EQ(std::get<0>(third), 50ull);
+   const auto fourth = run(9.5, 20);
+   EXPECT_EQ(nCalls, 230u);
+   EXPECT_EQ(std::get<3>(fourth), 20);
+
+   // the code of the compiled Define is not part of the key: without a tag, the results are not cached
+   run(9.5, 10, "");
+   EXPECT_EQ(nCalls, 320u);
+   run(9.5, 10, "");
+   EXPECT_EQ(nCalls, 410u);
+
+   // computation graphs with jitted nodes only are fully described by the key
+   auto runJitted = [&]() {
+      ROOT::RDataFrame df("t", fname);
+      ROOT::RDF::Experimental::EnableResultCache(df, cacheDir);
+      auto sum = df.Define("y", "++nJittedCalls; return 2. * x;").Filter("x > 9.5").Sum<double>("y");
+      return *sum;
+   };
+   gInterpreter->Declare("unsigned int nJittedCalls = 0;");
+   const auto jittedSum = runJitted();
+   EXPECT_EQ(jittedSum, runJitted());
+   EXPECT_EQ(gInterpreter->ProcessLine("nJittedCalls;"), 90);
+
+   void *dir = gSystem->OpenDirectory(cacheDir);
+   ASSERT_NE(dir, nullptr);
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (std::string(entry) != "." && std::string(entry) != "..")
+         gSystem->Unlink((std::string(cacheDir) + "/" + entry).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+   gSystem->Unlink(fname);
+}
+
+TEST(RDFHelpers, EnableJitCache)
+{
+   const auto cacheDir = "dataframe_helpers_jitcache";
+   ROOT::RDF::Experimental::EnableJitCache(cacheDir);
+   auto run = [] {
+      ROOT::RDataFrame df(100);
+      auto filtered = df.Define("x", "rdfentry_ * 0.5").Filter("x >= 25.");
+      auto count = filtered.Count();
+      auto sum = filtered.Sum("x");
+      return std::make_pair(*count, *sum);
+   };
+
+   // compiled and loaded the first time, only loaded the second time
+   const auto first = run();
+   EXPECT_EQ(first.first, 50ull);
+   EXPECT_DOUBLE_EQ(first.second, 0.5 * (50 + 99) * 50 / 2);
+   // expressions declared in the meantime, but not used by the event loop, do not change its library
+   ROOT::RDataFrame(1).Define("y", "rdfentry_ + 42");
+   EXPECT_EQ(run(), first);
+   ROOT::RDF::Experimental::EnableJitCache("");
+
+   unsigned int nLibraries = 0;
+   void *dir = gSystem->OpenDirectory(cacheDir);
+   ASSERT_NE(dir, nullptr);
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      if (name == "." || name == "..")
+         continue;
+      if (name.find("." + std::string(gSystem->GetSoExt())) != std::string::npos)
+         ++nLibraries;
+      gSystem->Unlink((std::string(cacheDir) + "/" + name).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+   EXPECT_EQ(nLibraries, 1u);
+}
+
 // The code below is a unit test for a function called `ProgressHelper_Existence_MT` in the `RDFHelpers` class.
 
 #ifdef R__USE_IMT
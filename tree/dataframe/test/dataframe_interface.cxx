@@ -937,3 +937,20 @@ TEST(RDataFrameInterface, PrintValueDataSource)
    auto printValue = cling::printValue(&df);
    EXPECT_EQ(printValue, "A data frame associated to the data source \"trivial data source\"");
 }
+
+TEST(RDataFrameInterface, IdenticalJittedNodesAreShared)
+{
+   gInterpreter->Declare("int gRDFNJittedCalls = 0; int RDFCountJittedCall(int x) { ++gRDFNJittedCalls; return x; }");
+   auto df = RDataFrame(10).Define("x", [] { return 1; }).Define("unused", [](int x) { return x; }, {"x"});
+
+   // a typical booking loop: the same Filter and Define are booked in every iteration
+   std::vector<ROOT::RDF::RResultPtr<int>> sums;
+   for (int i = 0; i < 3; ++i)
+      sums.emplace_back(df.Filter("RDFCountJittedCall(x) > 0").Define("y", "RDFCountJittedCall(x) + 1").Sum<int>("y"));
+
+   for (auto &sum : sums)
+      EXPECT_EQ(*sum, 20);
+   // the Filter and the Define are evaluated once per entry
+   EXPECT_EQ(gInterpreter->ProcessLine("gRDFNJittedCalls;"), 20);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+}
@@ -3,6 +3,7 @@
 
 #include <ROOT/TestSupport.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
 #include <TFile.h>
@@ -537,7 +538,110 @@ TEST_P(RDFSimpleTests, Aggregate)
    EXPECT_EQ(*r2, 120);
 }
 
+TEST_P(RDFSimpleTests, GroupBy)
+{
+   auto d = RDataFrame(100)
+               .DefineSlotEntry("key", [](unsigned int, ULong64_t e) { return static_cast<int>(e % 3); })
+               .DefineSlotEntry("x", [](unsigned int, ULong64_t e) { return static_cast<double>(e); })
+               .Define("v", [](double x) { return ROOT::RVecD{x, -x}; }, {"x"});
+   auto byKey = d.GroupBy<int>("key");
+   auto stats = byKey.Agg<double>("x");
+   auto vStats = byKey.Agg<ROOT::RVecD>("v");
+   auto histos = byKey.Histo1D<double>({"h", "h", 100, 0, 100}, "x");
+
+   ASSERT_EQ(stats->size(), 3u);
+   ASSERT_EQ(histos->size(), 3u);
+   for (int key = 0; key < 3; ++key) {
+      ULong64_t count = 0;
+      double sum = 0.;
+      for (int e = key; e < 100; e += 3) {
+         ++count;
+         sum += e;
+      }
+      const auto &s = stats->at(key);
+      EXPECT_EQ(s.GetCount(), count);
+      EXPECT_DOUBLE_EQ(s.GetSum(), sum);
+      EXPECT_DOUBLE_EQ(s.GetMean(), sum / count);
+      EXPECT_DOUBLE_EQ(s.GetMin(), key);
+      EXPECT_DOUBLE_EQ(s.GetMax(), 99 - (99 - key) % 3);
+      EXPECT_EQ(vStats->at(key).GetCount(), 2 * count);
+      EXPECT_DOUBLE_EQ(vStats->at(key).GetSum(), 0.);
+      EXPECT_EQ(histos->at(key).GetEntries(), count);
+      EXPECT_DOUBLE_EQ(histos->at(key).GetMean(), sum / count);
+   }
+   // one event loop for all the aggregations
+   EXPECT_EQ(d.GetNRuns(), 1u);
+}
+
+TEST_P(RDFSimpleTests, Profiling)
+{
+   ROOT::RDataFrame df(100);
+   ROOT::RDF::Experimental::EnableProfiling(df);
+   auto c = df.DefineSlotEntry("x", [](unsigned int, ULong64_t e) { return static_cast<int>(e); })
+               .Filter([](int x) { return x % 2 == 0; }, {"x"}, "even")
+               .Count();
+   EXPECT_EQ(*c, 50u);
+
+   const auto profile = ROOT::RDF::Experimental::GetProfileReport(df);
+   ASSERT_EQ(profile.GetNodes().size(), 3u);
+   const auto &x = profile.At("x");
+   EXPECT_EQ(x.fKind, "Define");
+   EXPECT_EQ(x.fCalls, 100u);
+   const auto &even = profile.At("even");
+   EXPECT_EQ(even.fKind, "Filter");
+   EXPECT_EQ(even.fCalls, 100u);
+   EXPECT_EQ(even.fPass, 50u);
+   EXPECT_EQ(even.fAll, 100u);
+   const auto &count = profile.At("Count");
+   EXPECT_EQ(count.fKind, "Action");
+   EXPECT_EQ(count.fCalls, 100u);
+   for (const auto &node : profile)
+      EXPECT_LE(node.fSelfTime, node.fTotalTime);
+   // the action includes the filter, which includes the define
+   EXPECT_GE(count.fTotalTime, even.fTotalTime);
+   EXPECT_GE(even.fTotalTime, x.fTotalTime);
+
+   ULong64_t slotEntries = 0;
+   for (const auto &slot : profile.GetSlots())
+      slotEntries += slot.fEntries;
+   EXPECT_EQ(slotEntries, 100u);
+   ULong64_t taskEntries = 0;
+   for (const auto &task : profile.GetTasks())
+      taskEntries += task.fEntries;
+   EXPECT_EQ(taskEntries, 100u);
+
+   EXPECT_NE(profile.AsJSON().find("\"name\": \"even\""), std::string::npos);
+   EXPECT_NE(profile.AsChromeTrace().find("\"traceEvents\""), std::string::npos);
+
+   // disabling profiling keeps the event loops running
+   ROOT::RDF::Experimental::EnableProfiling(df, false);
+   EXPECT_EQ(*df.Count(), 100u);
+   EXPECT_TRUE(ROOT::RDF::Experimental::GetProfileReport(df).GetNodes().empty());
+}
+
+TEST_P(RDFSimpleTests, Join)
+{
+   auto left = RDataFrame(100).DefineSlotEntry("key", [](unsigned int, ULong64_t e) { return e; });
+   auto right = RDataFrame(50)
+                   .DefineSlotEntry("key", [](unsigned int, ULong64_t e) { return 2 * e; })
+                   .DefineSlotEntry("y", [](unsigned int, ULong64_t e) { return static_cast<double>(e); });
+   auto joined = left.Join<ULong64_t, double, ULong64_t>(right, "key", {"y", "key"}, "r_");
+   auto c = joined.Count();
+   auto keys = joined.Take<ULong64_t>("key");
+   auto ys = joined.Take<double>("r_y");
+   auto rightKeys = joined.Take<ULong64_t>("r_key");
+   EXPECT_EQ(*c, 50u);
+   ASSERT_EQ(keys->size(), 50u);
+   for (std::size_t i = 0; i < keys->size(); ++i) {
+      EXPECT_EQ((*keys)[i] % 2, 0u);
+      EXPECT_DOUBLE_EQ((*ys)[i], (*keys)[i] / 2);
+      EXPECT_EQ((*rightKeys)[i], (*keys)[i]);
+   }
 
+   // keys of the joined dataset must be unique
+   auto duplicates = RDataFrame(10).DefineSlotEntry("key", [](unsigned int, ULong64_t e) { return e % 5; });
+   EXPECT_THROW(left.Join<ULong64_t>(duplicates, "key", {}), std::runtime_error);
+}
 
 TEST_P(RDFSimpleTests, AggregateGraph)
 {
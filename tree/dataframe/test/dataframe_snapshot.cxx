@@ -1354,5 +1354,28 @@ TEST(RDFSnapshotMore, ZeroOutputEntriesMT)
    gSystem->Unlink(fname);
 }
 
+#ifdef R__HAS_ROOT7
+TEST(RDFSnapshotMore, RNTupleOutputMT)
+{
+   ROOT::EnableImplicitMT(4);
+   const auto fname = "snapshot_rntupleoutputmt.root";
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(1000).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+
+   // entries are filled by all slots concurrently, the order in the output is not guaranteed
+   auto out = df.Snapshot<int>("ntuple", fname, {"x"}, opts);
+   EXPECT_EQ(*out->Count(), 1000u);
+   EXPECT_EQ(*out->Sum<int>("x"), 999 * 1000 / 2);
+
+   auto outJitted = df.Define("y", "x * 2").Snapshot("ntuple", fname, {"x", "y"}, opts);
+   EXPECT_EQ(*outJitted->Count(), 1000u);
+   EXPECT_EQ(*outJitted->Sum<int>("y"), 999 * 1000);
+
+   gSystem->Unlink(fname);
+   ROOT::DisableImplicitMT();
+}
+#endif // R__HAS_ROOT7
+
 #endif // R__USE_IMT
 
@@ -3,6 +3,7 @@
 #include <ROOT/RVec.hxx>
 
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleWriteOptions.hxx>
 #include <ROOT/RNTupleWriter.hxx>
 #include <ROOT/RPageStorage.hxx>
 
@@ -228,6 +229,78 @@ TEST_F(RNTupleDSTest, Chain)
    ChainTest(fNtplName, fFileName);
 }
 
+class RNTupleDSPushDownTest : public ::testing::Test {
+protected:
+   std::string fFileName = "RNTupleDS_test_pushdown.root";
+   std::string fNtplName = "ntuple";
+
+   void SetUp() override
+   {
+      auto model = RNTupleModel::Create();
+      auto fldX = model->MakeField<std::int32_t>("x");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), fNtplName, fFileName, options);
+      for (std::int32_t i = 0; i < 1000; ++i) {
+         *fldX = i;
+         fldJets->assign({static_cast<float>(i)});
+         writer->Fill();
+         if (i % 100 == 99)
+            writer->CommitCluster();
+      }
+   }
+
+   void TearDown() override { std::remove(fFileName.c_str()); }
+};
+
+TEST_F(RNTupleDSPushDownTest, SetEntry)
+{
+   using EOp = ROOT::RDF::RColumnPredicate::EOp;
+   RNTupleDS ds(fNtplName, fFileName);
+   ds.SetNSlots(1);
+   // Only predicates on top-level arithmetic fields are used
+   EXPECT_FALSE(ds.SetPushDownPredicates({{"jets", EOp::kGreater, 0.}}));
+   EXPECT_FALSE(ds.SetPushDownPredicates({{"nonexistent", EOp::kGreater, 0.}}));
+   EXPECT_TRUE(ds.SetPushDownPredicates({{"x", EOp::kGreaterEqual, 950.}}));
+   ds.Initialize();
+   unsigned int nPassing = 0;
+   for (auto ranges = ds.GetEntryRanges(); !ranges.empty(); ranges = ds.GetEntryRanges()) {
+      for (const auto &range : ranges) {
+         ds.InitSlot(0, range.first);
+         for (auto entry = range.first; entry < range.second; ++entry) {
+            const bool passes = ds.SetEntry(0, entry);
+            if (entry >= 950)
+               EXPECT_TRUE(passes);
+            nPassing += passes;
+         }
+         ds.FinalizeSlot(0);
+      }
+   }
+   ds.Finalize();
+   EXPECT_GE(nPassing, 50u);
+   EXPECT_LT(nPassing, 100u);
+}
+
+TEST_F(RNTupleDSPushDownTest, Filter)
+{
+   // The result of the event loop does not depend on whether the data source skips entries
+   auto df = ROOT::RDF::Experimental::FromRNTuple(fNtplName, fFileName);
+   auto countGE = df.Filter("x >= 950").Count();
+   auto sumLT = df.Filter("42 > x").Sum<std::int32_t>("x");
+   EXPECT_EQ(50u, countGE.GetValue());
+   EXPECT_EQ(861, sumLT.GetValue());
+   EXPECT_EQ(1u, df.Filter("x == 17").Count().GetValue());
+   // Named filters see all entries for their report
+   auto named = df.Filter("x < 10", "low");
+   EXPECT_EQ(10u, named.Count().GetValue());
+   EXPECT_EQ(10u, named.Report()->At("low").GetPass());
+   EXPECT_EQ(1000u, named.Report()->At("low").GetAll());
+   // Literals that do not fit into a double are valid C++; such filters are not pushed down
+   EXPECT_EQ(999u, df.Filter("x > 1e-400").Count().GetValue());
+   EXPECT_EQ(1000u, df.Filter("x < 1e400").Count().GetValue());
+}
+
 #ifdef R__USE_IMT
 struct IMTRAII {
    IMTRAII() { ROOT::EnableImplicitMT(); }
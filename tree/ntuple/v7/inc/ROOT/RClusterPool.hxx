@@ -19,18 +19,25 @@
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <future>
 #include <thread>
+#include <utility>
 #include <set>
 #include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
+class RNTupleDescriptor;
+
 namespace Internal {
 class RPageSource;
 
@@ -44,14 +51,28 @@ The cluster pool steers the preloading of (partial) clusters. There is a two-ste
 compressed pages are read from clusters into a memory buffer. The second pipeline step decompresses the pages
 and pushes them into the page pool. The actual logic of reading and unzipping is implemented by the page source.
 The cluster pool only orchestrates the work queues for reading and unzipping. It uses one extra I/O thread for
-reading waits for data from storage and generates no CPU load.
+reading waits for data from storage and generates no CPU load. The clusters that arrived are handed to a second
+thread that schedules their decompression as tasks of the page source, so that the I/O thread issues the next read
+while the previous clusters are unzipped.
 
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threading
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+The look-ahead window adapts to the observed access pattern. The pool records the distance between consecutively
+requested clusters. As long as the distance is constant (linear reading or a regular stride, e.g. from a sparse
+skim or an entry list), the following clusters are predicted with that stride and clusters in between are not read.
+If the access pattern is irregular, only the requested cluster is loaded until a stride emerges again.
+Furthermore, the pool measures the time the I/O thread needs to load a bunch of clusters and the time the reader
+spends on every cluster. If loading is slower than processing, the cluster bunch size grows up to the given maximum
+so that more clusters are in flight.
 */
 // clang-format on
 class RClusterPool {
+public:
+   /// Returns the current time of the clock that measures the loading and processing times of clusters
+   using ClockFunc_t = std::function<std::chrono::steady_clock::time_point()>;
+
 private:
    /// Request to load a subset of the columns of a particular cluster.
    /// Work items come in groups and are executed by the page source.
@@ -62,6 +83,13 @@ private:
       RCluster::RKey fClusterKey;
    };
 
+   /// A cluster that arrived from storage and whose pages are to be decompressed before it is handed out.
+   /// An item without cluster terminates the unzip thread.
+   struct RUnzipItem {
+      std::unique_ptr<RCluster> fCluster;
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+   };
+
    /// Clusters that are currently being processed by the pipeline.  Every in-flight cluster has a corresponding
    /// work item, first a read item and then an unzip item.
    struct RInFlightCluster {
@@ -86,13 +114,46 @@ private:
    /// The number of clusters before the currently active cluster that should stay in the pool if present
    /// Reserved for later use.
    unsigned int fWindowPre = 0;
-   /// The number of clusters that are being read in a single vector read.
+   /// The number of clusters that are being read in a single vector read.  Adjusted to the measured I/O latency
+   /// within [fMinClusterBunchSize, fMaxClusterBunchSize].
    unsigned int fClusterBunchSize;
+   /// The cluster bunch size requested by the page source; the adaptive bunch size never drops below this value
+   unsigned int fMinClusterBunchSize;
+   /// Upper limit of the adaptive bunch size; determines the size of fPool
+   unsigned int fMaxClusterBunchSize;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
 
+   /// Number of consecutive equal distances between requested clusters that establish a stride
+   static constexpr std::size_t kNStrideSamples = 2;
+   /// Distances larger than this number of clusters are considered as random jumps
+   static constexpr unsigned int kMaxStride = 16;
+   /// Number of timing samples taken before the cluster bunch size is adapted
+   static constexpr std::uint64_t kNWarmupSamples = 3;
+   /// The cluster id of the previous call to GetCluster()
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+   /// The most recent distances, in number of clusters, between requested clusters.  A zero entry denotes a backward
+   /// jump, a jump beyond kMaxStride, or no information.
+   std::array<unsigned int, kNStrideSamples> fDistances{};
+   /// The stride used to predict the next clusters.  Zero if the access pattern is irregular, in which case only the
+   /// requested cluster is loaded.
+   unsigned int fStride = 1;
+   /// The clock used for the timings of the adaptive bunch size; called by the reader thread and by the I/O thread
+   ClockFunc_t fClock = std::chrono::steady_clock::now;
+   /// The time point at which the previous call to GetCluster() returned
+   std::chrono::steady_clock::time_point fTimeLastReturn;
+   /// Time spent by the reader outside GetCluster() since it switched to the current cluster
+   std::chrono::nanoseconds fTimeConsumedCurrent{0};
+   /// Moving average of the time the reader spends on a cluster (in nanoseconds)
+   double fTimeConsumePerCluster = 0.0;
+   std::uint64_t fNConsumeSamples = 0;
+   /// Moving average of the wall-clock time of a single LoadClusters() call (in nanoseconds).  Written by the I/O
+   /// thread, protected by fLockWorkQueue.
+   double fTimeLoadPerBunch = 0.0;
+   std::uint64_t fNLoadSamples = 0;
+
    /// Protects the shared state between the main thread and the I/O thread, namely the work queue and the in-flight
    /// clusters vector
    std::mutex fLockWorkQueue;
@@ -108,6 +169,16 @@ private:
    /// main threads.
    std::thread fThreadIo;
 
+   /// Protects the unzip work queue shared between the I/O thread and the unzip thread
+   std::mutex fLockUnzipQueue;
+   /// Signals a non-empty unzip work queue
+   std::condition_variable fCvHasUnzipWork;
+   /// The communication channel from the I/O thread to the unzip thread
+   std::deque<RUnzipItem> fUnzipQueue;
+   /// The unzip thread calls RPageSource::UnzipCluster() for the loaded clusters and waits for the unzip tasks.  It is
+   /// the only thread that uses the task scheduler of the page source.
+   std::thread fThreadUnzip;
+
    /// Every cluster id has at most one corresponding RCluster pointer in the pool
    RCluster *FindInPool(DescriptorId_t clusterId) const;
    /// Returns an index of an unused element in fPool; callers of this function (GetCluster() and WaitFor())
@@ -115,14 +186,25 @@ private:
    size_t FindFreeSlot() const;
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
+   /// The unzip thread routine, there is exactly one unzip thread for every cluster pool
+   void ExecUnzipClusters();
    /// Returns the given cluster from the pool, which needs to contain at least the columns `physicalColumns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
+   /// Records the distance between the previously requested cluster and `clusterId` and derives fStride
+   void UpdateAccessPattern(DescriptorId_t clusterId, const RNTupleDescriptor &desc);
+   /// Sets fClusterBunchSize such that loading a bunch of clusters takes no longer than processing it
+   void UpdateClusterBunchSize();
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   /// If `maxClusterBunchSize` is larger than `clusterBunchSize`, the bunch size adapts to the measured I/O latency
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int maxClusterBunchSize);
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+      : RClusterPool(pageSource, clusterBunchSize, clusterBunchSize)
+   {
+   }
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -138,6 +220,13 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+   /// Used by the unit tests to simulate loading and processing times; must be called before the first GetCluster()
+   void SetClock(ClockFunc_t clock) { fClock = std::move(clock); }
+
+   /// The current, possibly adapted, number of clusters per vector read
+   unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
+   /// The stride derived from the access pattern; zero if the access pattern is irregular
+   unsigned int GetStride() const { return fStride; }
 }; // class RClusterPool
 
 } // namespace Internal
@@ -25,9 +25,12 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstddef> // for std::byte
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -60,10 +63,13 @@ namespace {
 //   - Zigzag:    Zigzag encoding is used on signed integers only. It maps x to 2x if x is positive and to -(2x+1) if
 //                x is negative. For series of positive and negative values of small absolute value, it will produce
 //                a bit pattern that is favorable for split encoding.
+//   - BitPack:   Frame-of-reference + bit packing stores the page minimum in a page header, followed by the
+//                differences to the minimum using only as many bits per element as the largest difference needs.
 //
 // Encodings/conversions can be fused:
 //
 //  - Delta/Zigzag + Splitting (there is no only-delta/zigzag encoding)
+//  - (Delta + ) BitPack
 //  - (Delta/Zigzag + ) Splitting + Casting
 //  - Everything + Byteswap
 
@@ -242,6 +248,196 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    }
 }
 
+/// \brief Pack the lowest `nBits` bits of `count` values into a little-endian bit stream
+///
+/// The values are provided by `getValue(i)`, which must not set bits above `nBits`. Values are stored without gaps,
+/// starting with the least significant bit of the first value. Bits are collected in 64bit words, so that the loop
+/// is free of per-bit branches. The stream occupies (count * nBits + 7) / 8 bytes.
+template <typename GetterT>
+static void BitPack(unsigned char *destination, std::size_t count, std::size_t nBits, GetterT &&getValue)
+{
+   if (nBits == 0)
+      return;
+
+   std::uint64_t word = 0;
+   std::size_t nBitsInWord = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      const std::uint64_t value = getValue(i);
+      word |= value << nBitsInWord;
+      nBitsInWord += nBits;
+      if (nBitsInWord >= 64) {
+         ByteSwapIfNecessary(word);
+         memcpy(destination, &word, sizeof(word));
+         destination += sizeof(word);
+         nBitsInWord -= 64;
+         // Carry over the bits of the value that did not fit into the flushed word
+         word = (nBitsInWord > 0) ? (value >> (nBits - nBitsInWord)) : 0;
+      }
+   }
+   if (nBitsInWord > 0) {
+      ByteSwapIfNecessary(word);
+      memcpy(destination, &word, (nBitsInWord + 7) / 8);
+   }
+}
+
+/// \brief Reverse of BitPack()
+///
+/// Every unpacked value is passed to `setValue(i, value)` in increasing order of `i`.
+template <typename SetterT>
+static void BitUnpack(const unsigned char *source, std::size_t count, std::size_t nBits, SetterT &&setValue)
+{
+   if (nBits == 0) {
+      for (std::size_t i = 0; i < count; ++i)
+         setValue(i, 0);
+      return;
+   }
+
+   const std::uint64_t mask = (nBits == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << nBits) - 1);
+   std::size_t nBytesLeft = (count * nBits + 7) / 8;
+   std::uint64_t word = 0;
+   std::size_t nBitsInWord = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      if (nBitsInWord >= nBits) {
+         setValue(i, word & mask);
+         word >>= nBits;
+         nBitsInWord -= nBits;
+         continue;
+      }
+
+      std::uint64_t next = 0;
+      const std::size_t nBytes = std::min(sizeof(next), nBytesLeft);
+      memcpy(&next, source, nBytes);
+      ByteSwapIfNecessary(next);
+      source += nBytes;
+      nBytesLeft -= nBytes;
+
+      setValue(i, (word | (next << nBitsInWord)) & mask);
+      const std::size_t nBitsFromNext = nBits - nBitsInWord;
+      word = (nBitsFromNext == 64) ? 0 : (next >> nBitsFromNext);
+      nBitsInWord = 64 - nBitsFromNext;
+   }
+}
+
+/// \brief The size of a frame-of-reference + bit-packed page of `count` elements of `nBytesMin` bytes, given the first
+/// byte of the page, which holds the bit width of the packed elements.
+static std::size_t GetBitPackedPageSize(const void *page, std::size_t count, std::size_t nBytesMin)
+{
+   const std::size_t nBits = *reinterpret_cast<const unsigned char *>(page);
+   if (nBits > 8 * nBytesMin) {
+      throw ROOT::Experimental::RException(R__FAIL("invalid bit width in bit-packed page: " + std::to_string(nBits)));
+   }
+   return 1 + nBytesMin + (count * nBits + 7) / 8;
+}
+
+/// \brief Packing of integer columns with frame-of-reference + bit packing, optionally on delta-encoded values
+///
+/// The packed page starts with one byte holding the bit width of the differences to the page minimum, followed by the
+/// page minimum as a little-endian DestT, followed by the bit-packed differences. The size of the page thus depends on
+/// the bit width, see GetBitPackedPageSize().
+template <typename DestT, typename SourceT, bool IsDelta>
+static void CastForBitPack(void *destination, const void *source, std::size_t count)
+{
+   using UDestT = std::make_unsigned_t<DestT>;
+   auto src = reinterpret_cast<const SourceT *>(source);
+   auto getValue = [src](std::size_t i) -> DestT {
+      if constexpr (IsDelta)
+         return (i == 0) ? src[0] : src[i] - src[i - 1];
+      else
+         return src[i];
+   };
+
+   DestT min = (count > 0) ? getValue(0) : 0;
+   DestT max = min;
+   for (std::size_t i = 1; i < count; ++i) {
+      const DestT val = getValue(i);
+      min = std::min(min, val);
+      max = std::max(max, val);
+   }
+   const UDestT range = static_cast<UDestT>(max) - static_cast<UDestT>(min);
+   std::uint8_t nBits = 0;
+   while ((nBits < 8 * sizeof(DestT)) && ((range >> nBits) != 0))
+      ++nBits;
+
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   dst[0] = nBits;
+   DestT minOnDisk = min;
+   ByteSwapIfNecessary(minOnDisk);
+   memcpy(dst + 1, &minOnDisk, sizeof(DestT));
+   dst += 1 + sizeof(DestT);
+   BitPack(dst, count, nBits, [&](std::size_t i) -> std::uint64_t {
+      return static_cast<UDestT>(static_cast<UDestT>(getValue(i)) - static_cast<UDestT>(min));
+   });
+}
+
+/// \brief Unpack frame-of-reference + bit-packed integers and unwind the delta encoding if necessary
+template <typename DestT, typename SourceT, bool IsDelta>
+static void CastForBitUnpack(void *destination, const void *source, std::size_t count)
+{
+   using USourceT = std::make_unsigned_t<SourceT>;
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   auto dst = reinterpret_cast<DestT *>(destination);
+
+   const std::size_t nBits = src[0];
+   if (nBits > 8 * sizeof(SourceT)) {
+      throw ROOT::Experimental::RException(R__FAIL("invalid bit width in bit-packed page: " + std::to_string(nBits)));
+   }
+   SourceT min;
+   memcpy(&min, src + 1, sizeof(SourceT));
+   ByteSwapIfNecessary(min);
+
+   BitUnpack(src + 1 + sizeof(SourceT), count, nBits, [&](std::size_t i, std::uint64_t diff) {
+      const SourceT val = static_cast<USourceT>(static_cast<USourceT>(min) + static_cast<USourceT>(diff));
+      if constexpr (IsDelta)
+         dst[i] = (i == 0) ? val : dst[i - 1] + val;
+      else
+         dst[i] = val;
+   });
+}
+
+/// \brief Determine the smallest and the largest of `count` in-memory elements
+///
+/// Only arithmetic types other than bool and char provide a value range. NaN values are ignored. The result is
+/// conservative with respect to the values read back: 64bit integers are rounded outwards when converted to double and
+/// doubles stored in 32bit columns are rounded like the stored values. Returns false if no range is available.
+template <typename CppT, std::size_t BitsOnStorage>
+static bool GetArithmeticValueRange(const void *source, std::size_t count, double &min, double &max)
+{
+   if constexpr (!std::is_arithmetic_v<CppT> || std::is_same_v<CppT, bool> || std::is_same_v<CppT, char>) {
+      return false;
+   } else {
+      auto src = reinterpret_cast<const CppT *>(source);
+      std::size_t i = 0;
+      if constexpr (std::is_floating_point_v<CppT>) {
+         while (i < count && std::isnan(src[i]))
+            ++i;
+      }
+      if (i == count)
+         return false;
+
+      CppT lo = src[i];
+      CppT hi = src[i];
+      for (++i; i < count; ++i) {
+         // For floating point values, NaN fails both comparisons
+         if (src[i] < lo)
+            lo = src[i];
+         if (src[i] > hi)
+            hi = src[i];
+      }
+      min = static_cast<double>(lo);
+      max = static_cast<double>(hi);
+      if constexpr (std::is_integral_v<CppT> && (sizeof(CppT) > 4)) {
+         min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+         max = std::nextafter(max, std::numeric_limits<double>::infinity());
+      }
+      if constexpr (std::is_floating_point_v<CppT> && (BitsOnStorage == 32)) {
+         // Rounding is monotonic, so the rounded extrema are the extrema of the rounded values
+         min = static_cast<float>(min);
+         max = static_cast<float>(max);
+      }
+      return true;
+   }
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -267,6 +463,11 @@ protected:
    /// Size of the C++ value that corresponds to the on-disk element
    std::size_t fSize;
    std::size_t fBitsOnStorage;
+   /// Number of bytes that precede the packed elements of every page, e.g. the frame of reference of bit-packed columns
+   std::size_t fPageHeaderSize = 0;
+   /// Number of bytes at the start of every packed page that stay uncompressed in the sealed page, so that the size of
+   /// pages whose size depends on their content can be determined before decompression, see GetPackedPageSize()
+   std::size_t fUnzippedPageHeaderSize = 0;
 
    explicit RColumnElementBase(std::size_t size, std::size_t bitsOnStorage = 0)
       : fSize(size), fBitsOnStorage(bitsOnStorage ? bitsOnStorage : 8 * size)
@@ -284,6 +485,9 @@ public:
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// The size of the packed page of nElements of the given column type, including the page header of encodings that
+   /// need one, given the start of the packed or the sealed page
+   static std::size_t GetPackedPageSize(EColumnType type, const void *page, std::size_t nElements);
    static std::string GetTypeName(EColumnType type);
 
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
@@ -305,9 +509,27 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Determine the range of the `count` in-memory elements at `source`. Only implemented for arithmetic types;
+   /// returns false if the range is not available.
+   virtual bool GetValueRange(const void * /* source */, std::size_t /* count */, double & /* min */,
+                              double & /* max */) const
+   {
+      return false;
+   }
+
    std::size_t GetSize() const { return fSize; }
    std::size_t GetBitsOnStorage() const { return fBitsOnStorage; }
    std::size_t GetPackedSize(std::size_t nElements = 1U) const { return (nElements * fBitsOnStorage + 7) / 8; }
+   std::size_t GetPageHeaderSize() const { return fPageHeaderSize; }
+   std::size_t GetUnzippedPageHeaderSize() const { return fUnzippedPageHeaderSize; }
+   /// The buffer size required by Pack() and Unpack() for a page of nElements, i.e. the largest packed page
+   std::size_t GetPackedPageSize(std::size_t nElements) const { return fPageHeaderSize + GetPackedSize(nElements); }
+   /// The size of the packed page of nElements, given the start of the packed or the sealed page. Smaller than
+   /// GetPackedPageSize(nElements) for encodings whose page size depends on the values, such as bit packing.
+   virtual std::size_t GetPackedPageSize(const void * /* page */, std::size_t nElements) const
+   {
+      return GetPackedPageSize(nElements);
+   }
 }; // class RColumnElementBase
 
 /**
@@ -429,6 +651,42 @@ public:
    }
 }; // class RColumnElementZigzagSplitLE
 
+/**
+ * Base class for frame-of-reference + bit-packed integer columns whose on-storage representation is little-endian.
+ * Every packed page is prefixed by the bit width of the packed elements and the page minimum. The bit width stays
+ * uncompressed when the page is sealed: it determines the size of the packed page.
+ * As part of the encoding, can also narrow down the type to NarrowT. If IsDelta is set, the deltas between consecutive
+ * elements are packed rather than the elements themselves; this is used for index columns.
+ */
+template <typename CppT, typename NarrowT, bool IsDelta = false>
+class RColumnElementBitPackLE : public RColumnElementBase {
+protected:
+   explicit RColumnElementBitPackLE(std::size_t size, std::size_t bitsOnStorage)
+      : RColumnElementBase(size, bitsOnStorage)
+   {
+      fPageHeaderSize = 1 + sizeof(NarrowT);
+      fUnzippedPageHeaderSize = 1;
+   }
+
+public:
+   static constexpr bool kIsMappable = false;
+
+   using RColumnElementBase::GetPackedPageSize;
+   std::size_t GetPackedPageSize(const void *page, std::size_t nElements) const final
+   {
+      return GetBitPackedPageSize(page, nElements, sizeof(NarrowT));
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      CastForBitPack<NarrowT, CppT, IsDelta>(dst, src, count);
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      CastForBitUnpack<CppT, NarrowT, IsDelta>(dst, src, count);
+   }
+}; // class RColumnElementBitPackLE
+
 ////////////////////////////////////////////////////////////////////////////////
 // Pairs of C++ type and column type, like float and EColumnType::kReal32
 ////////////////////////////////////////////////////////////////////////////////
@@ -623,6 +881,15 @@ public:
    static constexpr std::size_t kBitsOnStorage = 16;
    RColumnElement() : RColumnElementBase(kSize, kBitsOnStorage) {}
    bool IsMappable() const final { return kIsMappable; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      if (!GetArithmeticValueRange<float, 32>(source, count, min, max))
+         return false;
+      // Like in the float case, the rounded extrema are the extrema of the rounded values
+      min = HalfToFloat(FloatToHalf(static_cast<float>(min)));
+      max = HalfToFloat(FloatToHalf(static_cast<float>(max)));
+      return true;
+   }
 
    void Pack(void *dst, void *src, std::size_t count) const final
    {
@@ -647,13 +914,17 @@ public:
    }
 };
 
-#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)  \
-   static constexpr std::size_t kSize = sizeof(CppT);           \
-   static constexpr std::size_t kBitsOnStorage = BitsOnStorage; \
-   RColumnElement() : BaseT(kSize, kBitsOnStorage) {}           \
-   bool IsMappable() const final                                \
-   {                                                            \
-      return kIsMappable;                                       \
+#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)                                  \
+   static constexpr std::size_t kSize = sizeof(CppT);                                           \
+   static constexpr std::size_t kBitsOnStorage = BitsOnStorage;                                 \
+   RColumnElement() : BaseT(kSize, kBitsOnStorage) {}                                           \
+   bool IsMappable() const final                                                                \
+   {                                                                                            \
+      return kIsMappable;                                                                       \
+   }                                                                                            \
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const final \
+   {                                                                                            \
+      return GetArithmeticValueRange<CppT, BitsOnStorage>(src, count, min, max);                \
    }
 /// These macros are used to declare `RColumnElement` template specializations below.  Additional arguments can be used
 /// to forward template parameters to the base class, e.g.
@@ -694,6 +965,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kSplitInt16, 16, RColumnE
                             <std::int16_t, std::int16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kSplitUInt16, 16, RColumnElementSplitLE,
                             <std::int16_t, std::uint16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kBitPackedInt16, 16, RColumnElementBitPackLE,
+                            <std::int16_t, std::int16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int16_t, EColumnType::kBitPackedUInt16, 16, RColumnElementBitPackLE,
+                            <std::int16_t, std::uint16_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kUInt16, 16, RColumnElementLE, <std::uint16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kInt16, 16, RColumnElementLE, <std::uint16_t>);
@@ -701,6 +976,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kSplitUInt16, 16, RColum
                             <std::uint16_t, std::uint16_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kSplitInt16, 16, RColumnElementZigzagSplitLE,
                             <std::uint16_t, std::int16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kBitPackedUInt16, 16, RColumnElementBitPackLE,
+                            <std::uint16_t, std::uint16_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint16_t, EColumnType::kBitPackedInt16, 16, RColumnElementBitPackLE,
+                            <std::uint16_t, std::int16_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::int32_t>);
@@ -708,6 +987,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int32_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int32_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kBitPackedInt32, 32, RColumnElementBitPackLE,
+                            <std::int32_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kBitPackedUInt32, 32, RColumnElementBitPackLE,
+                            <std::int32_t, std::uint32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::uint32_t>);
@@ -715,6 +998,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitUInt32, 32, RColum
                             <std::uint32_t, std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitInt32, 32, RColumnElementZigzagSplitLE,
                             <std::uint32_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kBitPackedUInt32, 32, RColumnElementBitPackLE,
+                            <std::uint32_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kBitPackedInt32, 32, RColumnElementBitPackLE,
+                            <std::uint32_t, std::int32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::int64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::int64_t>);
@@ -729,6 +1016,14 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int64_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int64_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kBitPackedInt64, 64, RColumnElementBitPackLE,
+                            <std::int64_t, std::int64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kBitPackedUInt64, 64, RColumnElementBitPackLE,
+                            <std::int64_t, std::uint64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kBitPackedInt32, 32, RColumnElementBitPackLE,
+                            <std::int64_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kBitPackedUInt32, 32, RColumnElementBitPackLE,
+                            <std::int64_t, std::uint32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::uint64_t>);
@@ -736,6 +1031,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitUInt64, 64, RColum
                             <std::uint64_t, std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitInt64, 64, RColumnElementZigzagSplitLE,
                             <std::uint64_t, std::int64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kBitPackedUInt64, 64, RColumnElementBitPackLE,
+                            <std::uint64_t, std::uint64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kBitPackedInt64, 64, RColumnElementBitPackLE,
+                            <std::uint64_t, std::int64_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32, 32, RColumnElementLE, <float>);
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <float, float>);
@@ -752,6 +1051,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kSplitIndex64, 64, RColu
                             <std::uint64_t, std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kSplitIndex32, 32, RColumnElementDeltaSplitLE,
                             <std::uint64_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kBitPackedIndex64, 64, RColumnElementBitPackLE,
+                            <std::uint64_t, std::uint64_t, true>);
+DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kBitPackedIndex32, 32, RColumnElementBitPackLE,
+                            <std::uint64_t, std::uint32_t, true>);
 
 template <typename CppT>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType type)
@@ -784,6 +1087,16 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
+   case EColumnType::kBitPackedIndex64:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedIndex64>>();
+   case EColumnType::kBitPackedIndex32:
+      return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedIndex32>>();
+   case EColumnType::kBitPackedInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedInt64>>();
+   case EColumnType::kBitPackedUInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedUInt64>>();
+   case EColumnType::kBitPackedInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedInt32>>();
+   case EColumnType::kBitPackedUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedUInt32>>();
+   case EColumnType::kBitPackedInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedInt16>>();
+   case EColumnType::kBitPackedUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kBitPackedUInt16>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -34,6 +34,7 @@ New types need to be accounted for in RColumnElementBase::Generate() and RColumn
 When changed, remember to update
   - RColumnElement::Generate()
   - RColumnElement::GetBitsOnStorage()
+  - RColumnElement::GetPackedPageSize(), if the encoding uses a page header or pages of variable size
   - RColumnElement::GetTypeName()
   - RColumnElement template specializations / packing & unpacking
   - If necessary, endianess handling for the packing + unit test in ntuple_endian
@@ -72,6 +73,15 @@ enum class EColumnType {
    kSplitUInt32,
    kSplitInt16,
    kSplitUInt16,
+   // frame-of-reference + bit-packed integers; the index columns are delta encoded before packing
+   kBitPackedIndex64,
+   kBitPackedIndex32,
+   kBitPackedInt64,
+   kBitPackedUInt64,
+   kBitPackedInt32,
+   kBitPackedUInt32,
+   kBitPackedInt16,
+   kBitPackedUInt16,
    kMax,
 };
 
@@ -90,7 +100,9 @@ private:
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
    explicit RColumnModel(EColumnType type)
-      : fType(type), fIsSorted(type == EColumnType::kIndex32 || type == EColumnType::kSplitIndex32)
+      : fType(type),
+        fIsSorted(type == EColumnType::kIndex32 || type == EColumnType::kSplitIndex32 ||
+                  type == EColumnType::kBitPackedIndex32)
    {
    }
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
@@ -44,6 +44,7 @@
 #include <tuple>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -2392,6 +2393,11 @@ template <>
 class RField<std::string> final : public RFieldBase {
 private:
    ClusterSize_t fIndex;
+   /// Set if the field uses the dictionary representation: the principal column stores, for every entry, a code
+   /// into a per-cluster dictionary of distinct strings, which is stored in an offset column and a char column.
+   bool fIsDictionaryEncoded = false;
+   /// When writing a dictionary encoded field, maps the strings of the current cluster to their codes
+   std::unordered_map<std::string, std::uint32_t> fDictionary;
 
    std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const final
    {
@@ -2408,7 +2414,11 @@ private:
    std::size_t AppendImpl(const void *from) final;
    void ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex, void *to) final;
 
-   void CommitClusterImpl() final { fIndex = 0; }
+   void CommitClusterImpl() final
+   {
+      fIndex = 0;
+      fDictionary.clear();
+   }
 
 public:
    static std::string TypeName() { return "std::string"; }
@@ -2423,6 +2433,16 @@ public:
    size_t GetValueSize() const final { return sizeof(std::string); }
    size_t GetAlignment() const final { return std::alignment_of<std::string>(); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Only valid once the field is connected to a page sink or page source
+   bool IsDictionaryEncoded() const { return fIsDictionaryEncoded; }
+   /// For dictionary encoded fields, returns the location of the entry's string in the dictionary. The index part
+   /// is the dictionary code, which is unique for every distinct string within a cluster. Comparing codes thus
+   /// allows for grouping and filtering without reading the strings.
+   RClusterIndex GetDictionaryIndex(NTupleSize_t globalIndex) const;
+   RClusterIndex GetDictionaryIndex(RClusterIndex clusterIndex) const;
+   /// Reads the dictionary entry at the given location, as returned by GetDictionaryIndex()
+   void ReadDictionaryEntry(RClusterIndex dictionaryIndex, std::string &value) const;
 };
 
 /// TObject requires special handling of the fBits and fUniqueID members
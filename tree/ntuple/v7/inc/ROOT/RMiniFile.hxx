@@ -191,6 +191,18 @@ public:
    /// Write into a reserved record; the caller is responsible for making sure that the written byte range is in the
    /// previously reserved key.
    void WriteIntoReservedBlob(const void *buffer, size_t nbytes, std::int64_t offset);
+   /// Returns true if WriteIntoReservedBlobConcurrently() is supported, i.e. for files written through a C file stream
+   /// on POSIX systems
+   bool CanWriteConcurrently() const;
+   /// Writes the bytes buffered by the C file stream to the file, if any. Must be called after reserving blobs and
+   /// before writing into them with WriteIntoReservedBlobConcurrently().
+   void FlushStream();
+   /// Like WriteIntoReservedBlob() but uses positional writes on the file descriptor, bypassing the C file stream.
+   /// Thus it can be called concurrently to other writes without synchronization, as long as the byte range has been
+   /// reserved and FlushStream() has been called after the reservation. The flush makes sure that the positional
+   /// writes reach the file after the key headers written through the stream, and that later stream writes, which
+   /// never overlap with reserved ranges, do not depend on the order of the buffered and the positional writes.
+   void WriteIntoReservedBlobConcurrently(const void *buffer, size_t nbytes, std::int64_t offset);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
    void Commit();
 };
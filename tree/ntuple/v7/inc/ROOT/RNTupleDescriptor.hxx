@@ -30,6 +30,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <vector>
 #include <set>
@@ -202,6 +203,31 @@ public:
    bool HasAllColumns() const { return fPhysicalColumnIds.empty(); }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RColumnValueRange
+\ingroup NTuple
+\brief The smallest and largest value stored in a page or in the column range of a cluster
+
+Value ranges are only collected for arithmetic columns. They are given in terms of the in-memory C++ type of the
+column elements and they are conservative: every (non-NaN) value of the page or cluster is inside [fMin, fMax] but the
+bounds are not necessarily attained, e.g. 64bit integers are rounded outwards when converted to double.
+Readers can use the value ranges to skip pages and clusters that cannot match a selection.
+*/
+// clang-format on
+struct RColumnValueRange {
+   double fMin = 0.0;
+   double fMax = 0.0;
+
+   bool operator==(const RColumnValueRange &other) const { return fMin == other.fMin && fMax == other.fMax; }
+   /// Extend this range such that it also covers `other`
+   void Merge(const RColumnValueRange &other)
+   {
+      fMin = std::min(fMin, other.fMin);
+      fMax = std::max(fMax, other.fMax);
+   }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RClusterDescriptor
@@ -229,13 +255,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The range of values of the column in the cluster; only set if all the pages of the cluster have a value range
+      std::optional<RColumnValueRange> fValueRange;
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -262,9 +288,11 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// The range of values stored in the page, if collected by the page sink
+         std::optional<RColumnValueRange> fValueRange;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fValueRange == other.fValueRange;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -39,19 +39,35 @@ public:
       kOff,
       kDefault,
    };
+   /// If turned on, local files are mapped into memory and uncompressed pages of columns whose on-disk representation
+   /// matches the in-memory layout are served directly from the mapping without copying.
+   enum class EMemoryMap {
+      kOff,
+      kOn,
+      kDefault = kOff,
+   };
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// Upper bound for the cluster bunch size when the cluster pool adapts the look-ahead window to the measured
+   /// I/O latency. Values smaller than or equal to fClusterBunchSize, such as the default, turn the adaptation off.
+   /// The cluster pool keeps up to twice this number of clusters in memory.
+   unsigned int fMaxClusterBunchSize = 1;
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+   EMemoryMap fMemoryMap = EMemoryMap::kDefault;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val) { fMaxClusterBunchSize = val; }
    EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
    void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
+   EMemoryMap GetMemoryMap() const { return fMemoryMap; }
+   void SetMemoryMap(EMemoryMap val) { fMemoryMap = val; }
 };
 
 } // namespace Experimental
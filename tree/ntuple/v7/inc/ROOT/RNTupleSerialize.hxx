@@ -189,6 +189,9 @@ public:
    static std::uint32_t DeserializeInt64(const void *buffer, std::int64_t &val);
    static std::uint32_t SerializeUInt64(std::uint64_t val, void *buffer);
    static std::uint32_t DeserializeUInt64(const void *buffer, std::uint64_t &val);
+   /// Doubles are stored as the little-endian 64bit integer of their IEEE 754 bit pattern
+   static std::uint32_t SerializeDouble(double val, void *buffer);
+   static std::uint32_t DeserializeDouble(const void *buffer, double &val);
 
    static std::uint32_t SerializeString(const std::string &val, void *buffer);
    static RResult<std::uint32_t> DeserializeString(const void *buffer, std::uint64_t bufSize, std::string &val);
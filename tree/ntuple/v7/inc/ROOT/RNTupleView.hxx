@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <string_view>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -111,6 +113,10 @@ public:
       : fClusterId(clusterId), fStart(start), fEnd(end) {}
    RIterator begin() { return RIterator(RClusterIndex(fClusterId, fStart)); }
    RIterator end() { return RIterator(RClusterIndex(fClusterId, fEnd)); }
+
+   DescriptorId_t GetClusterId() const { return fClusterId; }
+   ClusterSize_t::ValueType GetStart() const { return fStart; }
+   ClusterSize_t::ValueType GetEnd() const { return fEnd; }
 };
 
 
@@ -138,6 +144,10 @@ accessed by index. For top-level fields, the index refers to the entry number. F
 nested collections have global index numbers that are derived from their parent indexes.
 
 Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+
+ReadBulk() returns the values of a range of entries within a cluster as a contiguous array. If the range is contained
+in a single page of a mappable field, the returned span points directly into the page. Otherwise, the values are read
+through an RFieldBase::RBulk owned by the view, which reads simple fields by memory copies of whole pages.
 */
 // clang-format on
 template <typename T, bool UserProvidedAddress>
@@ -152,6 +162,11 @@ private:
    FieldT fField;
    /// Used as a Read() destination for fields that are not mappable
    RFieldBase::RValue fValue;
+   /// Created on the first ReadBulk() call for ranges that cannot be served directly from a page
+   std::unique_ptr<RFieldBase::RBulk> fBulk;
+   /// Used as a request mask for bulk reads without a user-provided mask
+   std::unique_ptr<bool[]> fBulkMaskAll;
+   std::size_t fBulkMaskAllSize = 0;
 
    void SetupField(DescriptorId_t fieldId, Internal::RPageSource *pageSource)
    {
@@ -228,6 +243,40 @@ public:
       return fField.MapV(clusterIndex, nItems);
    }
 
+   /// Returns the values of the `size` entries starting at `firstIndex`; the range must not cross the cluster
+   /// boundary. Values for which the optional `maskReq` array is false may be left default-constructed; for simple
+   /// fields, the mask is ignored. The returned span is valid until the next read operation on the view.
+   std::span<const T> ReadBulk(RClusterIndex firstIndex, std::size_t size, const bool *maskReq = nullptr)
+   {
+      if (size == 0)
+         return std::span<const T>();
+
+      if constexpr (Internal::isMappable<FieldT> && !UserProvidedAddress) {
+         NTupleSize_t nItems;
+         const T *values = fField.MapV(firstIndex, nItems);
+         if (nItems >= size)
+            return std::span<const T>(values, size);
+      }
+
+      if (!fBulk)
+         fBulk = std::make_unique<RFieldBase::RBulk>(fField.CreateBulk());
+      if (!maskReq) {
+         if (fBulkMaskAllSize < size) {
+            fBulkMaskAll = std::make_unique<bool[]>(size);
+            std::fill(fBulkMaskAll.get(), fBulkMaskAll.get() + size, true);
+            fBulkMaskAllSize = size;
+         }
+         maskReq = fBulkMaskAll.get();
+      }
+      return std::span<const T>(static_cast<const T *>(fBulk->ReadBulk(firstIndex, maskReq, size)), size);
+   }
+
+   std::span<const T> ReadBulk(const RNTupleClusterRange &range, const bool *maskReq = nullptr)
+   {
+      return ReadBulk(RClusterIndex(range.GetClusterId(), range.GetStart()), range.GetEnd() - range.GetStart(),
+                      maskReq);
+   }
+
    void Bind(std::shared_ptr<T> objPtr)
    {
       static_assert(
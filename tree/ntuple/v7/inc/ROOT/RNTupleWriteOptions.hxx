@@ -55,9 +55,17 @@ protected:
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
    EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+   /// With buffered writing and implicit multi-threading, limits the memory of pages that are queued for being
+   /// compressed by background tasks. Once the limit is reached, the filling thread compresses the next pages itself
+   /// until the backlog drained. Zero means unlimited.
+   std::size_t fMaxInFlightPageBytes = 0;
    /// If set, 64bit index columns are replaced by 32bit index columns. This limits the cluster size to 512MB
    /// but it can result in smaller file sizes for data sets with many collections and lz4 or no compression.
    bool fHasSmallClusters = false;
+   /// If set, std::string fields without an explicit column representative are stored as per-cluster dictionaries
+   /// of distinct values plus one integer code per entry. This is beneficial for low-cardinality strings, such as
+   /// trigger names or run conditions, where every distinct value is only stored once per cluster.
+   bool fUseDictionaryEncoding = false;
 
 public:
    /// A maximum size of 512MB still allows for a vector of bool to be stored in a small cluster.  This is the
@@ -90,8 +98,14 @@ public:
    EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
    void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
 
+   std::size_t GetMaxInFlightPageBytes() const { return fMaxInFlightPageBytes; }
+   void SetMaxInFlightPageBytes(std::size_t val) { fMaxInFlightPageBytes = val; }
+
    bool GetHasSmallClusters() const { return fHasSmallClusters; }
    void SetHasSmallClusters(bool val) { fHasSmallClusters = val; }
+
+   bool GetUseDictionaryEncoding() const { return fUseDictionaryEncoding; }
+   void SetUseDictionaryEncoding(bool val) { fUseDictionaryEncoding = val; }
 };
 
 } // namespace Experimental
@@ -77,6 +77,24 @@ public:
    static void DeletePage(const RPage &page);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RPageAllocatorMmap
+\ingroup NTuple
+\brief Hands out pages that point into a read-only memory-mapped file
+
+The returned pages do not own their memory. They must not be written to and must not outlive the mapping.
+Only pages whose on-disk representation matches the in-memory layout of the column elements can be served this way.
+*/
+// clang-format on
+class RPageAllocatorMmap {
+public:
+   /// Returns a full page of nElements elements whose buffer is the given location in the mapped file
+   static RPage NewPage(ColumnId_t columnId, const void *mapped, std::size_t elementSize, std::size_t nElements);
+   /// No-op: the memory is owned by the mapping
+   static void DeletePage(const RPage & /* page */) {}
+};
+
 } // namespace Internal
 } // namespace Experimental
 } // namespace ROOT
@@ -21,6 +21,7 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <atomic>
 #include <deque>
 #include <iterator>
 #include <memory>
@@ -118,6 +119,7 @@ private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       Detail::RNTuplePlainCounter &fParallelZip;
+      Detail::RNTuplePlainCounter &fNPageSealedInline;
       Detail::RNTuplePlainCounter &fTimeWallCriticalSection;
       Detail::RNTupleTickCounter<Detail::RNTuplePlainCounter> &fTimeCpuCriticalSection;
    };
@@ -131,6 +133,8 @@ private:
    std::vector<RColumnBuf> fBufferedColumns;
    DescriptorId_t fNFields = 0;
    DescriptorId_t fNColumns = 0;
+   /// The number of bytes of page copies that are queued for or being sealed by a background task
+   std::atomic<std::size_t> fNBytesInFlight = 0;
 
    void ConnectFields(const std::vector<RFieldBase *> &fields, NTupleSize_t firstEntry);
 
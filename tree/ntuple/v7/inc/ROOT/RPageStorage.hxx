@@ -33,6 +33,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_set>
 #include <vector>
@@ -85,6 +86,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// The range of values in the page, as determined from the in-memory page by RPageSink::SealPage()
+      std::optional<RColumnValueRange> fValueRange;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -192,6 +195,9 @@ protected:
    /// Usage of this method requires construction of fCompressor.
    RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting);
 
+   /// Determine the range of values of an in-memory page, if the column element type supports it
+   static std::optional<RColumnValueRange> GetValueRange(const RPage &page, const RColumnElementBase &element);
+
    /// Seal a page using the provided buffer.
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting, void *buf,
                                bool allowAlias = true);
@@ -246,6 +252,15 @@ public:
    virtual void CommitSealedPage(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) = 0;
    /// Write a vector of preprocessed pages to storage. The corresponding columns must have been added before.
    virtual void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges) = 0;
+   /// Like CommitSealedPageV() but the sink may only reserve the storage for the pages and defer writing their
+   /// payload to the returned callable. The callable may be invoked without holding the sink guard, which allows
+   /// multiple fill contexts to write concurrently. It has to be invoked before the sealed page buffers are released
+   /// and before the cluster group is committed. An empty callable indicates that the pages are already written.
+   virtual std::function<void(void)> CommitSealedPageVDeferred(std::span<RPageStorage::RSealedPageGroup> ranges)
+   {
+      CommitSealedPageV(ranges);
+      return {};
+   }
    /// Finalize the current cluster and create a new one for the following data.
    /// Returns the number of bytes written to storage (excluding meta-data).
    virtual std::uint64_t CommitCluster(NTupleSize_t nNewEntries) = 0;
@@ -310,6 +325,10 @@ private:
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
 
+   /// Adds the given pages, stored at `locators`, to the open column and page ranges
+   void RegisterSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges,
+                            const std::vector<RNTupleLocator> &locators);
+
 protected:
    Internal::RNTupleDescriptorBuilder fDescriptorBuilder;
 
@@ -337,6 +356,11 @@ protected:
    /// The default is to call `CommitSealedPageImpl` for each page; derived classes may provide an
    /// optimized implementation though.
    virtual std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges);
+   /// Like CommitSealedPageVImpl() but may only reserve the storage for the pages. In this case, `writePayload` is set
+   /// to a callable that writes the pages into the reserved storage; see CommitSealedPageVDeferred(). The default is
+   /// to call `CommitSealedPageVImpl` and leave `writePayload` empty.
+   virtual std::vector<RNTupleLocator>
+   ReserveSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges, std::function<void(void)> &writePayload);
    /// Returns the number of bytes written to storage (excluding metadata)
    virtual std::uint64_t CommitClusterImpl() = 0;
    /// Returns the locator of the page list envelope of the given buffer that contains the serialized page list.
@@ -379,6 +403,7 @@ public:
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page) final;
    void CommitSealedPage(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) final;
    void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges) final;
+   std::function<void(void)> CommitSealedPageVDeferred(std::span<RPageStorage::RSealedPageGroup> ranges) final;
    std::uint64_t CommitCluster(NTupleSize_t nEntries) final;
    void CommitClusterGroup() final;
    void CommitDataset() final;
@@ -464,8 +489,10 @@ protected:
       Detail::RNTupleAtomicCounter &fNClusterLoaded;
       Detail::RNTupleAtomicCounter &fNPageLoaded;
       Detail::RNTupleAtomicCounter &fNPagePopulated;
+      Detail::RNTupleAtomicCounter &fNPageMapped;
       Detail::RNTupleAtomicCounter &fTimeWallRead;
       Detail::RNTupleAtomicCounter &fTimeWallUnzip;
+      Detail::RNTupleAtomicCounter &fTimeWallUnzipTasks;
       Detail::RNTupleTickCounter<Detail::RNTupleAtomicCounter> &fTimeCpuRead;
       Detail::RNTupleTickCounter<Detail::RNTupleAtomicCounter> &fTimeCpuUnzip;
       Detail::RNTupleCalcPerf &fBandwidthReadUncompressed;
@@ -473,6 +500,8 @@ protected:
       Detail::RNTupleCalcPerf &fBandwidthUnzip;
       Detail::RNTupleCalcPerf &fFractionReadOverhead;
       Detail::RNTupleCalcPerf &fCompressionRatio;
+      Detail::RNTupleCalcPerf &fParallelismUnzip;
+      Detail::RNTupleCalcPerf &fCpuWallRatioUnzip;
    };
 
    /// Keeps track of the requested physical column IDs. When using alias columns (projected fields), physical
@@ -65,6 +65,9 @@ private:
 
    RNTupleLocator WriteSealedPage(const RPageStorage::RSealedPage &sealedPage,
                                                 std::size_t bytesPacked);
+   /// Reserves a single blob for all the given pages and returns their locators in the blob. Returns an empty vector
+   /// if the pages do not fit into a single key.
+   std::vector<RNTupleLocator> ReserveSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges);
 
 protected:
    using RPagePersistentSink::InitImpl;
@@ -73,6 +76,8 @@ protected:
    RNTupleLocator
    CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) final;
    std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges) final;
+   std::vector<RNTupleLocator>
+   ReserveSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges, std::function<void(void)> &writePayload) final;
    std::uint64_t CommitClusterImpl() final;
    RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
    void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
@@ -119,6 +124,9 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    RMiniFileReader fReader;
+   /// If memory mapping is requested and supported by fFile, the read-only mapping of the entire file; owned by fFile
+   const unsigned char *fMappedFile = nullptr;
+   std::uint64_t fMappedFileSize = 0;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
@@ -131,6 +139,12 @@ private:
 
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Returns a page that points directly into fMappedFile if the page is stored uncompressed and its on-disk
+   /// representation matches the in-memory layout. Otherwise, returns a null page.
+   RPage MapPage(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo);
+   /// Whether the page of a mappable column with the given element size can be served from fMappedFile, i.e. it is
+   /// stored uncompressed, lies within the file, and is suitably aligned. Such pages are not read into clusters.
+   bool IsPageMappable(const RClusterDescriptor::RPageRange::RPageInfo &pageInfo, std::size_t elementSize) const;
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
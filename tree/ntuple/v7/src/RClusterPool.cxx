@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <future>
 #include <iostream>
 #include <iterator>
@@ -48,11 +49,28 @@ bool ROOT::Experimental::Internal::RClusterPool::RInFlightCluster::operator<(con
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Internal::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+namespace {
+
+/// Weight of a new sample in the exponential moving averages of the cluster pool timings
+constexpr double kTimingSampleWeight = 0.25;
+
+void UpdateMovingAverage(double &average, std::uint64_t &nSamples, double sample)
+{
+   average = (nSamples == 0) ? sample : (1.0 - kTimingSampleWeight) * average + kTimingSampleWeight * sample;
+   nSamples++;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Internal::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                         unsigned int maxClusterBunchSize)
    : fPageSource(pageSource),
      fClusterBunchSize(clusterBunchSize),
-     fPool(2 * clusterBunchSize),
-     fThreadIo(&RClusterPool::ExecReadClusters, this)
+     fMinClusterBunchSize(clusterBunchSize),
+     fMaxClusterBunchSize(std::max(clusterBunchSize, maxClusterBunchSize)),
+     fPool(2 * fMaxClusterBunchSize),
+     fThreadIo(&RClusterPool::ExecReadClusters, this),
+     fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
 }
@@ -66,6 +84,14 @@ ROOT::Experimental::Internal::RClusterPool::~RClusterPool()
       fCvHasReadWork.notify_one();
    }
    fThreadIo.join();
+
+   {
+      // The I/O thread does not add unzip items anymore
+      std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+      fUnzipQueue.emplace_back(RUnzipItem());
+      fCvHasUnzipWork.notify_one();
+   }
+   fThreadUnzip.join();
 }
 
 void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
@@ -95,28 +121,64 @@ void ROOT::Experimental::Internal::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
+         auto timeStart = fClock();
          auto clusters = fPageSource.LoadClusters(clusterKeys);
-         for (std::size_t i = 0; i < clusters.size(); ++i) {
-            // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
-            // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
-            bool discard;
-            {
-               std::unique_lock<std::mutex> lock(fLockWorkQueue);
-               discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
-                                     [thisClusterId = clusters[i]->GetId()](auto &inFlight) {
-                                        return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
-                                     });
-            }
-            if (discard) {
-               clusters[i].reset();
-            }
-            readItems[i].fPromise.set_value(std::move(clusters[i]));
+         std::chrono::duration<double, std::nano> timeLoad = fClock() - timeStart;
+         {
+            std::unique_lock<std::mutex> lock(fLockWorkQueue);
+            UpdateMovingAverage(fTimeLoadPerBunch, fNLoadSamples, timeLoad.count());
+         }
+         {
+            // The clusters are decompressed by the unzip thread, while this thread issues the next read
+            std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+            for (std::size_t i = 0; i < clusters.size(); ++i)
+               fUnzipQueue.emplace_back(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
+            fCvHasUnzipWork.notify_one();
          }
          readItems.erase(readItems.begin(), readItems.begin() + clusters.size());
       }
    } // while (true)
 }
 
+void ROOT::Experimental::Internal::RClusterPool::ExecUnzipClusters()
+{
+   std::deque<RUnzipItem> unzipItems;
+   while (true) {
+      {
+         std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+         fCvHasUnzipWork.wait(lock, [&] { return !fUnzipQueue.empty(); });
+         std::swap(unzipItems, fUnzipQueue);
+      }
+
+      for (auto &item : unzipItems) {
+         // An item without cluster is used as a marker for thread cancellation; it must appear last in the queue.
+         if (R__unlikely(!item.fCluster))
+            return;
+
+         // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
+         // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
+         bool discard;
+         {
+            std::unique_lock<std::mutex> lock(fLockWorkQueue);
+            discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
+                                  [thisClusterId = item.fCluster->GetId()](auto &inFlight) {
+                                     return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
+                                  });
+         }
+         if (discard) {
+            item.fCluster.reset();
+         } else {
+            // Decompress the pages in the task arena before handing out the cluster, so that the unzip work
+            // neither blocks the reader thread nor uses the task scheduler from more than one thread.
+            // Noop unless the page source has a task scheduler.
+            fPageSource.UnzipCluster(item.fCluster.get());
+         }
+         item.fPromise.set_value(std::move(item.fCluster));
+      }
+      unzipItems.clear();
+   } // while (true)
+}
+
 ROOT::Experimental::Internal::RCluster *
 ROOT::Experimental::Internal::RClusterPool::FindInPool(DescriptorId_t clusterId) const
 {
@@ -139,6 +201,64 @@ size_t ROOT::Experimental::Internal::RClusterPool::FindFreeSlot() const
    return N;
 }
 
+void ROOT::Experimental::Internal::RClusterPool::UpdateAccessPattern(DescriptorId_t clusterId,
+                                                                    const RNTupleDescriptor &desc)
+{
+   unsigned int distance = 0;
+   if (fLastClusterId != kInvalidDescriptorId) {
+      auto next = fLastClusterId;
+      for (unsigned int i = 1; i <= kMaxStride; ++i) {
+         next = desc.FindNextClusterId(next);
+         if (next == kInvalidDescriptorId)
+            break;
+         if (next == clusterId) {
+            distance = i;
+            break;
+         }
+      }
+   }
+   std::copy_backward(fDistances.begin(), fDistances.end() - 1, fDistances.end());
+   fDistances[0] = distance;
+
+   if (fLastClusterId == kInvalidDescriptorId) {
+      // No information yet: assume linear reading
+      fStride = 1;
+   } else if (std::all_of(fDistances.begin(), fDistances.end(), [&](unsigned int d) { return d == distance; })) {
+      // Established stride; for distance == 0, a series of random jumps
+      fStride = distance;
+   } else {
+      // The pattern changed.  Linear reading is the common case and it is cheap to resume it right away, everything
+      // else needs confirmation by the next request.
+      fStride = (distance == 1) ? 1 : 0;
+   }
+   fLastClusterId = clusterId;
+}
+
+void ROOT::Experimental::Internal::RClusterPool::UpdateClusterBunchSize()
+{
+   if (fMaxClusterBunchSize == fMinClusterBunchSize)
+      return;
+
+   double timeLoadPerBunch;
+   std::uint64_t nLoadSamples;
+   {
+      std::lock_guard<std::mutex> lockGuard(fLockWorkQueue);
+      timeLoadPerBunch = fTimeLoadPerBunch;
+      nLoadSamples = fNLoadSamples;
+   }
+   if ((nLoadSamples < kNWarmupSamples) || (fNConsumeSamples < kNWarmupSamples))
+      return;
+
+   // While the reader processes the clusters of one bunch, the next bunch is being loaded.  In order for the reader
+   // not to wait, a bunch needs to contain at least as many clusters as the reader processes during one load call.
+   unsigned int bunchSize = fMaxClusterBunchSize;
+   if (fTimeConsumePerCluster > 0.0) {
+      bunchSize = static_cast<unsigned int>(
+         std::min<double>(fMaxClusterBunchSize, std::ceil(timeLoadPerBunch / fTimeConsumePerCluster)));
+   }
+   fClusterBunchSize = std::max(fMinClusterBunchSize, bunchSize);
+}
+
 
 namespace {
 
@@ -198,11 +318,24 @@ ROOT::Experimental::Internal::RCluster *
 ROOT::Experimental::Internal::RClusterPool::GetCluster(DescriptorId_t clusterId,
                                                        const RCluster::ColumnSet_t &physicalColumns)
 {
+   // Time spent by the reader since the previous call; accumulated until the reader moves on to the next cluster
+   if (fLastClusterId != kInvalidDescriptorId)
+      fTimeConsumedCurrent += fClock() - fTimeLastReturn;
+   const bool isNewCluster = (clusterId != fLastClusterId);
+   if (isNewCluster && (fLastClusterId != kInvalidDescriptorId)) {
+      UpdateMovingAverage(fTimeConsumePerCluster, fNConsumeSamples, fTimeConsumedCurrent.count());
+      fTimeConsumedCurrent = std::chrono::nanoseconds(0);
+      UpdateClusterBunchSize();
+   }
+
    std::set<DescriptorId_t> keep;
    RProvides provide;
    {
       auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
 
+      if (isNewCluster)
+         UpdateAccessPattern(clusterId, descriptorGuard.GetRef());
+
       // Determine previous cluster ids that we keep if they happen to be in the pool
       auto prev = clusterId;
       for (unsigned int i = 0; i < fWindowPre; ++i) {
@@ -217,12 +350,16 @@ ROOT::Experimental::Internal::RClusterPool::GetCluster(DescriptorId_t clusterId,
       provideInfo.fPhysicalColumnSet = physicalColumns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
+      // With an irregular access pattern, only the requested cluster is loaded
+      const DescriptorId_t nProvide = (fStride == 0) ? 1 : 2 * fClusterBunchSize;
+      for (DescriptorId_t i = 0, next = clusterId; i < nProvide; ++i) {
          if (i == fClusterBunchSize)
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
-         next = descriptorGuard->FindNextClusterId(cid);
+         // Clusters in between strides are not going to be requested and thus skipped
+         for (unsigned int s = 0; (s < std::max(fStride, 1u)) && (next != kInvalidDescriptorId); ++s)
+            next = descriptorGuard->FindNextClusterId(next);
          if (next != kInvalidClusterIndex) {
             if (!fPageSource.GetEntryRange().IntersectsWith(descriptorGuard->GetClusterDescriptor(next)))
                next = kInvalidClusterIndex;
@@ -334,7 +471,9 @@ ROOT::Experimental::Internal::RClusterPool::GetCluster(DescriptorId_t clusterId,
       }
    } // work queue lock guard
 
-   return WaitFor(clusterId, physicalColumns);
+   auto result = WaitFor(clusterId, physicalColumns);
+   fTimeLastReturn = fClock();
+   return result;
 }
 
 ROOT::Experimental::Internal::RCluster *
@@ -375,8 +514,6 @@ ROOT::Experimental::Internal::RClusterPool::WaitFor(DescriptorId_t clusterId,
 
       auto cptr = itr->fFuture.get();
       if (result) {
-         // Noop unless the page source has a task scheduler
-         fPageSource.UnzipCluster(cptr.get());
          result->Adopt(std::move(*cptr));
       } else {
          auto idxFreeSlot = FindFreeSlot();
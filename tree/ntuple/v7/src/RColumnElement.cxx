@@ -58,6 +58,22 @@ ROOT::Experimental::Internal::RColumnElementBase::Generate<void>(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kSplitUInt16>>();
+   case EColumnType::kBitPackedIndex64:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kBitPackedIndex64>>();
+   case EColumnType::kBitPackedIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kBitPackedIndex32>>();
+   case EColumnType::kBitPackedInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kBitPackedInt64>>();
+   case EColumnType::kBitPackedUInt64:
+      return std::make_unique<RColumnElement<std::uint64_t, EColumnType::kBitPackedUInt64>>();
+   case EColumnType::kBitPackedInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kBitPackedInt32>>();
+   case EColumnType::kBitPackedUInt32:
+      return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kBitPackedUInt32>>();
+   case EColumnType::kBitPackedInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kBitPackedInt16>>();
+   case EColumnType::kBitPackedUInt16:
+      return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kBitPackedUInt16>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -94,12 +110,37 @@ std::size_t ROOT::Experimental::Internal::RColumnElementBase::GetBitsOnStorage(E
    case EColumnType::kSplitUInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
    case EColumnType::kSplitUInt16: return 16;
+   case EColumnType::kBitPackedIndex64: return 64;
+   case EColumnType::kBitPackedIndex32: return 32;
+   case EColumnType::kBitPackedInt64: return 64;
+   case EColumnType::kBitPackedUInt64: return 64;
+   case EColumnType::kBitPackedInt32: return 32;
+   case EColumnType::kBitPackedUInt32: return 32;
+   case EColumnType::kBitPackedInt16: return 16;
+   case EColumnType::kBitPackedUInt16: return 16;
    default: R__ASSERT(false);
    }
    // never here
    return 0;
 }
 
+std::size_t ROOT::Experimental::Internal::RColumnElementBase::GetPackedPageSize(EColumnType type, const void *page,
+                                                                               std::size_t nElements)
+{
+   const auto bitsOnStorage = GetBitsOnStorage(type);
+   switch (type) {
+   case EColumnType::kBitPackedIndex64:
+   case EColumnType::kBitPackedIndex32:
+   case EColumnType::kBitPackedInt64:
+   case EColumnType::kBitPackedUInt64:
+   case EColumnType::kBitPackedInt32:
+   case EColumnType::kBitPackedUInt32:
+   case EColumnType::kBitPackedInt16:
+   case EColumnType::kBitPackedUInt16: return GetBitPackedPageSize(page, nElements, bitsOnStorage / 8);
+   default: return (bitsOnStorage * nElements + 7) / 8;
+   }
+}
+
 std::string ROOT::Experimental::Internal::RColumnElementBase::GetTypeName(EColumnType type)
 {
    switch (type) {
@@ -130,6 +171,14 @@ std::string ROOT::Experimental::Internal::RColumnElementBase::GetTypeName(EColum
    case EColumnType::kSplitUInt32: return "SplitUInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
    case EColumnType::kSplitUInt16: return "SplitUInt16";
+   case EColumnType::kBitPackedIndex64: return "BitPackedIndex64";
+   case EColumnType::kBitPackedIndex32: return "BitPackedIndex32";
+   case EColumnType::kBitPackedInt64: return "BitPackedInt64";
+   case EColumnType::kBitPackedUInt64: return "BitPackedUInt64";
+   case EColumnType::kBitPackedInt32: return "BitPackedInt32";
+   case EColumnType::kBitPackedUInt32: return "BitPackedUInt32";
+   case EColumnType::kBitPackedInt16: return "BitPackedInt16";
+   case EColumnType::kBitPackedUInt16: return "BitPackedUInt16";
    default: return "UNKNOWN";
    }
 }
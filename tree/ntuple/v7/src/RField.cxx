@@ -974,7 +974,14 @@ void ROOT::Experimental::RFieldBase::RemoveReadCallback(size_t idx)
 
 void ROOT::Experimental::RFieldBase::AutoAdjustColumnTypes(const RNTupleWriteOptions &options)
 {
-   if ((options.GetCompression() == 0) && HasDefaultColumnRepresentative()) {
+   // The dictionary representation replaces the default one; the following adjustments still apply to it
+   const bool hasDefaultColumnRepresentative = HasDefaultColumnRepresentative();
+   if (options.GetUseDictionaryEncoding() && hasDefaultColumnRepresentative &&
+       dynamic_cast<RField<std::string> *>(this)) {
+      SetColumnRepresentative({EColumnType::kSplitUInt32, EColumnType::kSplitIndex64, EColumnType::kChar});
+   }
+
+   if ((options.GetCompression() == 0) && hasDefaultColumnRepresentative) {
       ColumnRepresentation_t rep = GetColumnRepresentative();
       for (auto &colType : rep) {
          switch (colType) {
@@ -985,6 +992,9 @@ void ROOT::Experimental::RFieldBase::AutoAdjustColumnTypes(const RNTupleWriteOpt
          case EColumnType::kSplitInt64: colType = EColumnType::kInt64; break;
          case EColumnType::kSplitInt32: colType = EColumnType::kInt32; break;
          case EColumnType::kSplitInt16: colType = EColumnType::kInt16; break;
+         case EColumnType::kSplitUInt64: colType = EColumnType::kUInt64; break;
+         case EColumnType::kSplitUInt32: colType = EColumnType::kUInt32; break;
+         case EColumnType::kSplitUInt16: colType = EColumnType::kUInt16; break;
          default: break;
          }
       }
@@ -997,6 +1007,7 @@ void ROOT::Experimental::RFieldBase::AutoAdjustColumnTypes(const RNTupleWriteOpt
          switch (colType) {
          case EColumnType::kSplitIndex64: colType = EColumnType::kSplitIndex32; break;
          case EColumnType::kIndex64: colType = EColumnType::kIndex32; break;
+         case EColumnType::kBitPackedIndex64: colType = EColumnType::kBitPackedIndex32; break;
          default: break;
          }
       }
@@ -1100,7 +1111,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -1127,7 +1143,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCardinalityField::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -1347,8 +1368,9 @@ void ROOT::Experimental::RField<double>::SetDouble32()
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt16}, {EColumnType::kInt16}},
-                                                 {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}, {EColumnType::kBitPackedInt16}},
+      {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}, {EColumnType::kBitPackedUInt16}});
    return representations;
 }
 
@@ -1373,8 +1395,9 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint16_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}},
-                                                 {{EColumnType::kSplitInt16}, {EColumnType::kInt16}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt16}, {EColumnType::kUInt16}, {EColumnType::kBitPackedUInt16}},
+      {{EColumnType::kSplitInt16}, {EColumnType::kInt16}, {EColumnType::kBitPackedInt16}});
    return representations;
 }
 
@@ -1399,8 +1422,9 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}},
-                                                 {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kBitPackedInt32}},
+      {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}, {EColumnType::kBitPackedUInt32}});
    return representations;
 }
 
@@ -1425,8 +1449,9 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}},
-                                                 {{EColumnType::kSplitInt32}, {EColumnType::kInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}, {EColumnType::kBitPackedUInt32}},
+      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kBitPackedInt32}});
    return representations;
 }
 
@@ -1451,8 +1476,9 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}},
-                                                 {{EColumnType::kSplitInt64}, {EColumnType::kInt64}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}, {EColumnType::kBitPackedUInt64}},
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kBitPackedInt64}});
    return representations;
 }
 
@@ -1477,13 +1503,17 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
-                                                 {{EColumnType::kSplitUInt64},
-                                                  {EColumnType::kUInt64},
-                                                  {EColumnType::kInt32},
-                                                  {EColumnType::kSplitInt32},
-                                                  {EColumnType::kUInt32},
-                                                  {EColumnType::kSplitUInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kBitPackedInt64}},
+      {{EColumnType::kSplitUInt64},
+       {EColumnType::kUInt64},
+       {EColumnType::kBitPackedUInt64},
+       {EColumnType::kInt32},
+       {EColumnType::kSplitInt32},
+       {EColumnType::kBitPackedInt32},
+       {EColumnType::kUInt32},
+       {EColumnType::kSplitUInt32},
+       {EColumnType::kBitPackedUInt32}});
    return representations;
 }
 
@@ -1508,23 +1538,46 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::string>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitIndex64, EColumnType::kChar},
-                                                  {EColumnType::kIndex64, EColumnType::kChar},
-                                                  {EColumnType::kSplitIndex32, EColumnType::kChar},
-                                                  {EColumnType::kIndex32, EColumnType::kChar}},
-                                                 {});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitIndex64, EColumnType::kChar},
+       {EColumnType::kIndex64, EColumnType::kChar},
+       {EColumnType::kSplitIndex32, EColumnType::kChar},
+       {EColumnType::kIndex32, EColumnType::kChar},
+       {EColumnType::kBitPackedIndex64, EColumnType::kChar},
+       {EColumnType::kBitPackedIndex32, EColumnType::kChar},
+       // Dictionary encoding: per-entry codes, followed by the per-cluster dictionary
+       {EColumnType::kSplitUInt32, EColumnType::kSplitIndex64, EColumnType::kChar},
+       {EColumnType::kUInt32, EColumnType::kIndex64, EColumnType::kChar},
+       {EColumnType::kSplitUInt32, EColumnType::kSplitIndex32, EColumnType::kChar},
+       {EColumnType::kUInt32, EColumnType::kIndex32, EColumnType::kChar}},
+      {});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Internal::RColumn::Create<ClusterSize_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
-   fColumns.emplace_back(Internal::RColumn::Create<char>(RColumnModel(GetColumnRepresentative()[1]), 1));
+   const auto &representative = GetColumnRepresentative();
+   fIsDictionaryEncoded = (representative.size() == 3);
+   if (fIsDictionaryEncoded) {
+      fColumns.emplace_back(Internal::RColumn::Create<std::uint32_t>(RColumnModel(representative[0]), 0));
+      fColumns.emplace_back(Internal::RColumn::Create<ClusterSize_t>(RColumnModel(representative[1]), 1));
+      fColumns.emplace_back(Internal::RColumn::Create<char>(RColumnModel(representative[2]), 2));
+      return;
+   }
+   fColumns.emplace_back(Internal::RColumn::Create<ClusterSize_t>(RColumnModel(representative[0]), 0));
+   fColumns.emplace_back(Internal::RColumn::Create<char>(RColumnModel(representative[1]), 1));
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
    auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
+   fIsDictionaryEncoded = (onDiskTypes.size() == 3);
+   if (fIsDictionaryEncoded) {
+      fColumns.emplace_back(Internal::RColumn::Create<std::uint32_t>(RColumnModel(onDiskTypes[0]), 0));
+      fColumns.emplace_back(Internal::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[1]), 1));
+      fColumns.emplace_back(Internal::RColumn::Create<char>(RColumnModel(onDiskTypes[2]), 2));
+      return;
+   }
    fColumns.emplace_back(Internal::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[0]), 0));
    fColumns.emplace_back(Internal::RColumn::Create<char>(RColumnModel(onDiskTypes[1]), 1));
 }
@@ -1532,6 +1585,20 @@ void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleD
 std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const void *from)
 {
    auto typedValue = static_cast<const std::string *>(from);
+   if (fIsDictionaryEncoded) {
+      std::size_t nbytes = 0;
+      auto [itr, isNew] = fDictionary.emplace(*typedValue, static_cast<std::uint32_t>(fDictionary.size()));
+      if (isNew) {
+         auto length = typedValue->length();
+         fColumns[2]->AppendV(typedValue->data(), length);
+         fIndex += length;
+         fColumns[1]->Append(&fIndex);
+         nbytes += length + fColumns[1]->GetElement()->GetPackedSize();
+      }
+      fColumns[0]->Append(&itr->second);
+      return nbytes + fColumns[0]->GetElement()->GetPackedSize();
+   }
+
    auto length = typedValue->length();
    fColumns[1]->AppendV(typedValue->data(), length);
    fIndex += length;
@@ -1542,6 +1609,11 @@ std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const void *from
 void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex, void *to)
 {
    auto typedValue = static_cast<std::string *>(to);
+   if (fIsDictionaryEncoded) {
+      ReadDictionaryEntry(GetDictionaryIndex(globalIndex), *typedValue);
+      return;
+   }
+
    RClusterIndex collectionStart;
    ClusterSize_t nChars;
    fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nChars);
@@ -1553,6 +1625,40 @@ void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(ROOT::Experimental:
    }
 }
 
+ROOT::Experimental::RClusterIndex
+ROOT::Experimental::RField<std::string>::GetDictionaryIndex(NTupleSize_t globalIndex) const
+{
+   if (!fIsDictionaryEncoded)
+      throw RException(R__FAIL("field " + GetQualifiedFieldName() + " is not dictionary encoded"));
+   const auto code = *fPrincipalColumn->Map<std::uint32_t>(globalIndex);
+   return RClusterIndex(fPrincipalColumn->GetClusterIndex(globalIndex).GetClusterId(), code);
+}
+
+ROOT::Experimental::RClusterIndex
+ROOT::Experimental::RField<std::string>::GetDictionaryIndex(RClusterIndex clusterIndex) const
+{
+   if (!fIsDictionaryEncoded)
+      throw RException(R__FAIL("field " + GetQualifiedFieldName() + " is not dictionary encoded"));
+   const auto code = *fPrincipalColumn->Map<std::uint32_t>(clusterIndex);
+   return RClusterIndex(clusterIndex.GetClusterId(), code);
+}
+
+void ROOT::Experimental::RField<std::string>::ReadDictionaryEntry(RClusterIndex dictionaryIndex,
+                                                                  std::string &value) const
+{
+   if (!fIsDictionaryEncoded)
+      throw RException(R__FAIL("field " + GetQualifiedFieldName() + " is not dictionary encoded"));
+   RClusterIndex collectionStart;
+   ClusterSize_t nChars;
+   fColumns[1]->GetCollectionInfo(dictionaryIndex, &collectionStart, &nChars);
+   if (nChars == 0) {
+      value.clear();
+   } else {
+      value.resize(nChars);
+      fColumns[2]->ReadV(collectionStart, nChars, const_cast<char *>(value.data()));
+   }
+}
+
 void ROOT::Experimental::RField<std::string>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitStringField(*this);
@@ -2061,7 +2167,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RProxiedCollectionField::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -2330,7 +2441,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RVectorField::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -2571,7 +2687,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RRVecField::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -2688,7 +2809,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::vector<bool>>::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -3258,7 +3384,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RNullableField::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32},
        {EColumnType::kBit}}, {});
    return representations;
 }
@@ -3562,7 +3693,12 @@ const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RCollectionField::GetColumnRepresentations() const
 {
    static RColumnRepresentations representations(
-      {{EColumnType::kSplitIndex64}, {EColumnType::kIndex64}, {EColumnType::kSplitIndex32}, {EColumnType::kIndex32}},
+      {{EColumnType::kSplitIndex64},
+       {EColumnType::kIndex64},
+       {EColumnType::kSplitIndex32},
+       {EColumnType::kIndex32},
+       {EColumnType::kBitPackedIndex64},
+       {EColumnType::kBitPackedIndex32}},
       {});
    return representations;
 }
@@ -38,6 +38,10 @@
 #include <utility>
 #include <chrono>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace {
 
 // The following types are used to read and write the TFile binary format
@@ -1412,6 +1416,49 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::WriteIntoReservedBlob(cons
    }
 }
 
+bool ROOT::Experimental::Internal::RNTupleFileWriter::CanWriteConcurrently() const
+{
+#ifdef _WIN32
+   return false;
+#else
+   return static_cast<bool>(fFileSimple);
+#endif
+}
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::FlushStream()
+{
+   if (fFileSimple && fflush(fFileSimple.fFile) != 0)
+      throw RException(R__FAIL(std::string("flush failed: ") + strerror(errno)));
+}
+
+void ROOT::Experimental::Internal::RNTupleFileWriter::WriteIntoReservedBlobConcurrently(const void *buffer,
+                                                                                        size_t nbytes,
+                                                                                        std::int64_t offset)
+{
+#ifdef _WIN32
+   (void)buffer;
+   (void)nbytes;
+   (void)offset;
+   throw RException(R__FAIL("concurrent writes are not supported on this platform"));
+#else
+   R__ASSERT(fFileSimple);
+   // The caller flushed the C file stream after reserving the byte range, see FlushStream()
+   const int fd = fileno(fFileSimple.fFile);
+   auto data = static_cast<const unsigned char *>(buffer);
+   while (nbytes > 0) {
+      auto retval = pwrite(fd, data, nbytes, offset);
+      if (retval < 0) {
+         if (errno == EINTR)
+            continue;
+         throw RException(R__FAIL(std::string("pwrite failed: ") + strerror(errno)));
+      }
+      data += retval;
+      nbytes -= retval;
+      offset += retval;
+   }
+#endif
+}
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteNTupleHeader(
    const void *data, size_t nbytes, size_t lenHeader)
 {
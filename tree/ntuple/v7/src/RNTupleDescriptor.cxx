@@ -539,9 +539,20 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RClusterDescript
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, ClusterSize_t{0}};
    columnRange.fCompressionSettings = compressionSettings;
+   bool hasValueRange = !pageRange.fPageInfos.empty();
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      if (!pi.fValueRange) {
+         hasValueRange = false;
+      } else if (hasValueRange) {
+         if (columnRange.fValueRange)
+            columnRange.fValueRange->Merge(*pi.fValueRange);
+         else
+            columnRange.fValueRange = pi.fValueRange;
+      }
    }
+   if (!hasValueRange)
+      columnRange.fValueRange.reset();
    fCluster.fPageRanges[physicalId] = pageRange.Clone();
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
@@ -591,7 +602,9 @@ ROOT::Experimental::Internal::RClusterDescriptorBuilder::AddDeferredColumnRanges
                   columnRange.fFirstElementIndex = fCluster.GetFirstEntryIndex() * nRepetitions;
                   columnRange.fNElements = fCluster.GetNEntries() * nRepetitions;
                   const auto element = Internal::RColumnElementBase::Generate<void>(c.GetModel().GetType());
-                  pageRange.ExtendToFitColumnRange(columnRange, *element, Internal::RPage::kPageZeroSize);
+                  // The synthesized pages carry no value range, so neither does the column range of the cluster
+                  if (pageRange.ExtendToFitColumnRange(columnRange, *element, Internal::RPage::kPageZeroSize) > 0)
+                     columnRange.fValueRange.reset();
                }
             }
          },
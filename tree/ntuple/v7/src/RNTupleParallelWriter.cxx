@@ -89,6 +89,10 @@ public:
    {
       fInnerSink->CommitSealedPageV(ranges);
    }
+   std::function<void(void)> CommitSealedPageVDeferred(std::span<RPageStorage::RSealedPageGroup> ranges) final
+   {
+      return fInnerSink->CommitSealedPageVDeferred(ranges);
+   }
    std::uint64_t CommitCluster(NTupleSize_t nNewEntries) final { return fInnerSink->CommitCluster(nNewEntries); }
    void CommitClusterGroup() final
    {
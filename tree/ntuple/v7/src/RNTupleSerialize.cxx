@@ -23,8 +23,10 @@
 #include <RVersion.h>
 #include <xxhash.h>
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <deque>
+#include <limits>
 #include <set>
 #include <unordered_map>
 
@@ -465,6 +467,22 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   static_assert(sizeof(double) == sizeof(std::uint64_t));
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto result = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return result;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -528,6 +546,14 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitUInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x1C, buffer);
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kBitPackedIndex64: return SerializeUInt16(0x1D, buffer);
+   case EColumnType::kBitPackedIndex32: return SerializeUInt16(0x1E, buffer);
+   case EColumnType::kBitPackedInt64: return SerializeUInt16(0x1F, buffer);
+   case EColumnType::kBitPackedUInt64: return SerializeUInt16(0x20, buffer);
+   case EColumnType::kBitPackedInt32: return SerializeUInt16(0x21, buffer);
+   case EColumnType::kBitPackedUInt32: return SerializeUInt16(0x22, buffer);
+   case EColumnType::kBitPackedInt16: return SerializeUInt16(0x23, buffer);
+   case EColumnType::kBitPackedUInt16: return SerializeUInt16(0x24, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -567,6 +593,14 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x14: type = EColumnType::kSplitUInt32; break;
    case 0x1C: type = EColumnType::kSplitInt16; break;
    case 0x15: type = EColumnType::kSplitUInt16; break;
+   case 0x1D: type = EColumnType::kBitPackedIndex64; break;
+   case 0x1E: type = EColumnType::kBitPackedIndex32; break;
+   case 0x1F: type = EColumnType::kBitPackedInt64; break;
+   case 0x20: type = EColumnType::kBitPackedUInt64; break;
+   case 0x21: type = EColumnType::kBitPackedInt32; break;
+   case 0x22: type = EColumnType::kBitPackedUInt32; break;
+   case 0x23: type = EColumnType::kBitPackedInt16; break;
+   case 0x24: type = EColumnType::kBitPackedUInt16; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1312,6 +1346,20 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList(void *buffer,
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional page value ranges; older readers skip them as part of the inner frame
+         const bool hasValueRanges = std::any_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                                                 [](const auto &pi) { return pi.fValueRange.has_value(); });
+         if (hasValueRanges) {
+            pos += SerializeUInt32(pageRange.fPageInfos.size(), *where);
+            for (const auto &pi : pageRange.fPageInfos) {
+               // Pages without value range are marked by an empty interval
+               const auto valueRange = pi.fValueRange.value_or(RColumnValueRange{
+                  std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()});
+               pos += SerializeDouble(valueRange.fMin, *where);
+               pos += SerializeDouble(valueRange.fMax, *where);
+            }
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1639,6 +1687,22 @@ ROOT::Experimental::Internal::RNTupleSerializer::DeserializePageList(const void
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         if (fnInnerFrameSizeLeft() >= static_cast<int>(sizeof(std::uint32_t))) {
+            std::uint32_t nValueRanges;
+            bytes += DeserializeUInt32(bytes, nValueRanges);
+            if (nValueRanges != nPages)
+               return R__FAIL("page value range count mismatch");
+            if (fnInnerFrameSizeLeft() < static_cast<int>(nPages * 2 * sizeof(double)))
+               return R__FAIL("page value ranges too short");
+            for (auto &pi : pageRange.fPageInfos) {
+               RColumnValueRange valueRange;
+               bytes += DeserializeDouble(bytes, valueRange.fMin);
+               bytes += DeserializeDouble(bytes, valueRange.fMax);
+               if (valueRange.fMin <= valueRange.fMax)
+                  pi.fValueRange = valueRange;
+            }
+         }
+
          clusterBuilders[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       } // loop over columns
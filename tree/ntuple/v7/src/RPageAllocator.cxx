@@ -33,3 +33,13 @@ void ROOT::Experimental::Internal::RPageAllocatorHeap::DeletePage(const RPage &p
    if (!page.IsPageZero())
       delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+ROOT::Experimental::Internal::RPage
+ROOT::Experimental::Internal::RPageAllocatorMmap::NewPage(ColumnId_t columnId, const void *mapped,
+                                                          std::size_t elementSize, std::size_t nElements)
+{
+   R__ASSERT(mapped && (elementSize > 0) && (nElements > 0));
+   RPage page(columnId, const_cast<void *>(mapped), elementSize, nElements);
+   page.GrowUnchecked(nElements);
+   return page;
+}
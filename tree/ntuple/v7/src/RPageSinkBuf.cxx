@@ -21,6 +21,7 @@
 #include <ROOT/RPageSinkBuf.hxx>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 
 void ROOT::Experimental::Internal::RPageSinkBuf::RColumnBuf::DropBufferedPages()
@@ -42,6 +43,8 @@ ROOT::Experimental::Internal::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSi
    fMetrics = Detail::RNTupleMetrics("RPageSinkBuf");
    fCounters = std::make_unique<RCounters>(RCounters{
       *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("ParallelZip", "", "compressing pages in parallel"),
+      *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>(
+         "nPageSealedInline", "", "number of pages compressed by the filling thread due to the in-flight memory limit"),
       *fMetrics.MakeCounter<Detail::RNTuplePlainCounter *>("timeWallCriticalSection", "ns",
                                                            "wall clock time spent in critical sections"),
       *fMetrics.MakeCounter<Detail::RNTupleTickCounter<Detail::RNTuplePlainCounter> *>(
@@ -139,11 +142,20 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
    // valid until the return value of DrainBufferedPages() goes out of scope in
    // CommitCluster().
    auto &zipItem = fBufferedColumns.at(colId).BufferPage(columnHandle);
-   zipItem.AllocateSealedPageBuf(page.GetNBytes());
+   zipItem.AllocateSealedPageBuf(
+      std::max<std::size_t>(page.GetNBytes(), element.GetPackedPageSize(page.GetNElements())));
    R__ASSERT(zipItem.fBuf);
    auto &sealedPage = fBufferedColumns.at(colId).RegisterSealedPage();
 
-   if (!fTaskScheduler) {
+   // Backpressure: if the background tasks lag behind, the filling thread seals the page itself instead of growing
+   // the backlog of page copies. A single page is always allowed in flight, even if it exceeds the limit.
+   const auto nBytesPage = page.GetNBytes();
+   const auto maxInFlight = GetWriteOptions().GetMaxInFlightPageBytes();
+   const auto nBytesInFlight = fNBytesInFlight.load();
+   const bool isOverBudget = (maxInFlight > 0) && (nBytesInFlight > 0) && (nBytesInFlight + nBytesPage > maxInFlight);
+   if (!fTaskScheduler || isOverBudget) {
+      if (isOverBudget)
+         fCounters->fNPageSealedInline.Inc();
       // Seal the page right now, avoiding the allocation and copy, but making sure that the page buffer is not aliased.
       sealedPage =
          SealPage(page, element, GetWriteOptions().GetCompression(), zipItem.fBuf.get(), /*allowAlias=*/false);
@@ -155,14 +167,21 @@ void ROOT::Experimental::Internal::RPageSinkBuf::CommitPage(ColumnHandle_t colum
    zipItem.fPage = ReservePage(columnHandle, page.GetNElements());
    // make sure the page is aware of how many elements it will have
    zipItem.fPage.GrowUnchecked(page.GetNElements());
-   memcpy(zipItem.fPage.GetBuffer(), page.GetBuffer(), page.GetNBytes());
+   memcpy(zipItem.fPage.GetBuffer(), page.GetBuffer(), nBytesPage);
+   fNBytesInFlight += nBytesPage;
 
    fCounters->fParallelZip.SetValue(1);
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
-   fTaskScheduler->AddTask([this, &zipItem, &sealedPage, &element] {
+   fTaskScheduler->AddTask([this, &zipItem, &sealedPage, &element, nBytesPage] {
       sealedPage = SealPage(zipItem.fPage, element, GetWriteOptions().GetCompression(), zipItem.fBuf.get());
       zipItem.fSealedPage = &sealedPage;
+      // Unless the sealed page aliases the page copy, the copy is not needed anymore until the cluster is committed
+      if (sealedPage.fBuffer != zipItem.fPage.GetBuffer()) {
+         ReleasePage(zipItem.fPage);
+         zipItem.fPage = RPage();
+      }
+      fNBytesInFlight -= nBytesPage;
    });
 }
 
@@ -190,13 +209,18 @@ std::uint64_t ROOT::Experimental::Internal::RPageSinkBuf::CommitCluster(ROOT::Ex
    }
 
    std::uint64_t nbytes;
+   std::function<void(void)> writePayload;
    {
       RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
       Detail::RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
-      fInnerSink->CommitSealedPageV(toCommit);
+      // Only reserve the space for the pages if the inner sink supports it, so that the critical section is short
+      writePayload = fInnerSink->CommitSealedPageVDeferred(toCommit);
 
       nbytes = fInnerSink->CommitCluster(nNewEntries);
    }
+   // Outside of the critical section: other fill contexts can commit their clusters while we write the pages
+   if (writePayload)
+      writePayload();
 
    for (auto &bufColumn : fBufferedColumns)
       bufColumn.DropBufferedPages();
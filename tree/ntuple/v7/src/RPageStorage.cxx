@@ -200,9 +200,13 @@ void ROOT::Experimental::Internal::RPageSource::EnableDefaultMetrics(const std::
                                                             "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPageMapped", "",
+                                                            "number of pages served from the memory-mapped file"),
       *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("timeWallRead", "ns", "wall clock time spent reading"),
       *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("timeWallUnzip", "ns",
                                                             "wall clock time spent decompressing"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>(
+         "timeWallUnzipTasks", "ns", "wall clock time spent in parallel decompression tasks, summed over all tasks"),
       *fMetrics.MakeCounter<Detail::RNTupleTickCounter<Detail::RNTupleAtomicCounter> *>("timeCpuRead", "ns",
                                                                                         "CPU time spent reading"),
       *fMetrics.MakeCounter<Detail::RNTupleTickCounter<Detail::RNTupleAtomicCounter> *>("timeCpuUnzip", "ns",
@@ -276,6 +280,32 @@ void ROOT::Experimental::Internal::RPageSource::EnableDefaultMetrics(const std::
                }
             }
             return {false, -1.};
+         }),
+      *fMetrics.MakeCounter<Detail::RNTupleCalcPerf *>(
+         "rtParallelismUnzip", "", "average number of parallel decompression tasks at work while decompressing",
+         fMetrics,
+         [](const Detail::RNTupleMetrics &metrics) -> std::pair<bool, double> {
+            if (const auto timeWallUnzipTasks = metrics.GetLocalCounter("timeWallUnzipTasks")) {
+               if (const auto timeWallUnzip = metrics.GetLocalCounter("timeWallUnzip")) {
+                  auto tasktime = timeWallUnzipTasks->GetValueAsInt();
+                  if (auto walltime = timeWallUnzip->GetValueAsInt(); walltime && tasktime) {
+                     return {true, (1. * tasktime) / walltime};
+                  }
+               }
+            }
+            return {false, -1.};
+         }),
+      *fMetrics.MakeCounter<Detail::RNTupleCalcPerf *>(
+         "rtCpuWallUnzip", "", "ratio of process CPU time over wall clock time spent decompressing", fMetrics,
+         [](const Detail::RNTupleMetrics &metrics) -> std::pair<bool, double> {
+            if (const auto timeCpuUnzip = metrics.GetLocalCounter("timeCpuUnzip")) {
+               if (const auto timeWallUnzip = metrics.GetLocalCounter("timeWallUnzip")) {
+                  if (auto walltime = timeWallUnzip->GetValueAsInt()) {
+                     return {true, (1. * timeCpuUnzip->GetValueAsInt()) / walltime};
+                  }
+               }
+            }
+            return {false, -1.};
          })});
 }
 
@@ -291,19 +321,35 @@ ROOT::Experimental::Internal::RPageSource::UnsealPage(const RSealedPage &sealedP
       return page;
    }
 
-   const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
+   // The size of the packed page can depend on its content, which is described by the uncompressed page header
+   const auto unzippedHeaderSize = element.GetUnzippedPageHeaderSize();
+   if (sealedPage.fSize < unzippedHeaderSize)
+      throw RException(R__FAIL("sealed page too small for its page header"));
+   const auto bytesPacked = element.GetPackedPageSize(sealedPage.fBuffer, sealedPage.fNElements);
    using Allocator_t = RPageAllocatorHeap;
    auto page = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
+   // Packed pages with a page header, e.g. bit-packed integers, can be larger than the in-memory page
+   std::unique_ptr<unsigned char[]> packedBuffer;
+   void *packed = page.GetBuffer();
+   if (bytesPacked > element.GetSize() * sealedPage.fNElements) {
+      packedBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesPacked]);
+      packed = packedBuffer.get();
+   }
    if (sealedPage.fSize != bytesPacked) {
-      fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, page.GetBuffer());
+      memcpy(packed, sealedPage.fBuffer, unzippedHeaderSize);
+      fDecompressor->Unzip(static_cast<const unsigned char *>(sealedPage.fBuffer) + unzippedHeaderSize,
+                           sealedPage.fSize - unzippedHeaderSize, bytesPacked - unzippedHeaderSize,
+                           static_cast<unsigned char *>(packed) + unzippedHeaderSize);
    } else {
       // We cannot simply map the sealed page as we don't know its life time. Specialized page sources
       // may decide to implement to not use UnsealPage but to custom mapping / decompression code.
       // Note that usually pages are compressed.
-      memcpy(page.GetBuffer(), sealedPage.fBuffer, bytesPacked);
+      memcpy(packed, sealedPage.fBuffer, bytesPacked);
    }
 
-   if (!element.IsMappable()) {
+   if (packedBuffer) {
+      element.Unpack(page.GetBuffer(), packed, sealedPage.fNElements);
+   } else if (!element.IsMappable()) {
       auto tmp = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
       element.Unpack(tmp.GetBuffer(), page.GetBuffer(), sealedPage.fNElements);
       Allocator_t::DeletePage(page);
@@ -323,6 +369,15 @@ ROOT::Experimental::Internal::RPageSink::RPageSink(std::string_view name, const
 
 ROOT::Experimental::Internal::RPageSink::~RPageSink() {}
 
+std::optional<ROOT::Experimental::RColumnValueRange>
+ROOT::Experimental::Internal::RPageSink::GetValueRange(const RPage &page, const RColumnElementBase &element)
+{
+   RColumnValueRange valueRange;
+   if (!element.GetValueRange(page.GetBuffer(), page.GetNElements(), valueRange.fMin, valueRange.fMax))
+      return std::nullopt;
+   return valueRange;
+}
+
 ROOT::Experimental::Internal::RPageStorage::RSealedPage
 ROOT::Experimental::Internal::RPageSink::SealPage(const RPage &page, const RColumnElementBase &element,
                                                   int compressionSetting, void *buf, bool allowAlias)
@@ -332,15 +387,20 @@ ROOT::Experimental::Internal::RPageSink::SealPage(const RPage &page, const RColu
    auto packedBytes = page.GetNBytes();
 
    if (!element.IsMappable()) {
-      packedBytes = element.GetPackedSize(page.GetNElements());
-      pageBuf = new unsigned char[packedBytes];
+      pageBuf = new unsigned char[element.GetPackedPageSize(page.GetNElements())];
       isAdoptedBuffer = false;
       element.Pack(pageBuf, page.GetBuffer(), page.GetNElements());
+      packedBytes = element.GetPackedPageSize(pageBuf, page.GetNElements());
    }
    auto zippedBytes = packedBytes;
 
    if ((compressionSetting != 0) || !element.IsMappable() || !allowAlias) {
-      zippedBytes = RNTupleCompressor::Zip(pageBuf, packedBytes, compressionSetting, buf);
+      // The uncompressed page header tells the reader the size of the packed page
+      const auto unzippedHeaderSize = element.GetUnzippedPageHeaderSize();
+      memcpy(buf, pageBuf, unzippedHeaderSize);
+      zippedBytes = unzippedHeaderSize +
+                    RNTupleCompressor::Zip(pageBuf + unzippedHeaderSize, packedBytes - unzippedHeaderSize,
+                                           compressionSetting, static_cast<unsigned char *>(buf) + unzippedHeaderSize);
       if (!isAdoptedBuffer)
          delete[] pageBuf;
       pageBuf = reinterpret_cast<unsigned char *>(buf);
@@ -349,7 +409,9 @@ ROOT::Experimental::Internal::RPageSink::SealPage(const RPage &page, const RColu
 
    R__ASSERT(isAdoptedBuffer);
 
-   return RSealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
+   RSealedPage sealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
+   sealedPage.fValueRange = GetValueRange(page, element);
+   return sealedPage;
 }
 
 ROOT::Experimental::Internal::RPageStorage::RSealedPage
@@ -526,6 +588,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitPage(ColumnHandle_
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
+   pageInfo.fValueRange = GetValueRange(page, *columnHandle.fColumn->GetElement());
    fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -537,6 +600,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPage(Descrip
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
+   pageInfo.fValueRange = sealedPage.fValueRange;
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -555,7 +619,28 @@ ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageVImpl(
 void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageV(
    std::span<RPageStorage::RSealedPageGroup> ranges)
 {
-   auto locators = CommitSealedPageVImpl(ranges);
+   RegisterSealedPageV(ranges, CommitSealedPageVImpl(ranges));
+}
+
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Internal::RPagePersistentSink::ReserveSealedPageVImpl(
+   std::span<RPageStorage::RSealedPageGroup> ranges, std::function<void(void)> &writePayload)
+{
+   writePayload = nullptr;
+   return CommitSealedPageVImpl(ranges);
+}
+
+std::function<void(void)> ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageVDeferred(
+   std::span<RPageStorage::RSealedPageGroup> ranges)
+{
+   std::function<void(void)> writePayload;
+   RegisterSealedPageV(ranges, ReserveSealedPageVImpl(ranges, writePayload));
+   return writePayload;
+}
+
+void ROOT::Experimental::Internal::RPagePersistentSink::RegisterSealedPageV(
+   std::span<RPageStorage::RSealedPageGroup> ranges, const std::vector<RNTupleLocator> &locators)
+{
    unsigned i = 0;
 
    for (auto &range : ranges) {
@@ -565,6 +650,7 @@ void ROOT::Experimental::Internal::RPagePersistentSink::CommitSealedPageV(
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
          pageInfo.fLocator = locators[i++];
+         pageInfo.fValueRange = sealedPageIt->fValueRange;
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
    }
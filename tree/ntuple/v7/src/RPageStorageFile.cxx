@@ -31,8 +31,10 @@
 #include <RVersion.h>
 #include <TError.h>
 #include <TFile.h>
+#include <TROOT.h> // GetThreadPoolSize
 
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -46,6 +48,7 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <unordered_map>
 
 ROOT::Experimental::Internal::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
                                                            const RNTupleWriteOptions &options)
@@ -115,22 +118,22 @@ ROOT::Experimental::Internal::RPageSinkFile::CommitPageImpl(ColumnHandle_t colum
    }
 
    fCounters->fSzZip.Add(page.GetNBytes());
-   return WriteSealedPage(sealedPage, element->GetPackedSize(page.GetNElements()));
+   return WriteSealedPage(sealedPage, element->GetPackedPageSize(sealedPage.fBuffer, sealedPage.fNElements));
 }
 
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t physicalColumnId,
                                                                   const RPageStorage::RSealedPage &sealedPage)
 {
-   const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType());
-   const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
+   const auto bytesPacked = RColumnElementBase::GetPackedPageSize(
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType(),
+      sealedPage.fBuffer, sealedPage.fNElements);
 
    return WriteSealedPage(sealedPage, bytesPacked);
 }
 
 std::vector<ROOT::Experimental::RNTupleLocator>
-ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges)
+ROOT::Experimental::Internal::RPageSinkFile::ReserveSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges)
 {
    size_t size = 0, bytesPacked = 0;
    for (auto &range : ranges) {
@@ -139,28 +142,27 @@ ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVImpl(std::span<RPa
          continue;
       }
 
-      const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fPhysicalColumnId).GetModel().GetType());
+      const auto columnType =
+         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fPhysicalColumnId).GetModel().GetType();
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
          size += sealedPageIt->fSize;
-         bytesPacked += (bitsOnStorage * sealedPageIt->fNElements + 7) / 8;
+         bytesPacked +=
+            RColumnElementBase::GetPackedPageSize(columnType, sealedPageIt->fBuffer, sealedPageIt->fNElements);
       }
    }
    if (size >= std::numeric_limits<std::int32_t>::max() || bytesPacked >= std::numeric_limits<std::int32_t>::max()) {
-      // Cannot fit it into one key, fall back to one key per page.
+      // Cannot fit it into one key
       // TODO: Remove once there is support for large keys.
-      return RPagePersistentSink::CommitSealedPageVImpl(ranges);
+      return {};
    }
 
-   Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
    // Reserve a blob that is large enough to hold all pages.
    std::uint64_t offset = fWriter->ReserveBlob(size, bytesPacked);
 
-   // Now write the individual pages and record their locators.
+   // Now record the locators of the individual pages.
    std::vector<ROOT::Experimental::RNTupleLocator> locators;
    for (auto &range : ranges) {
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
-         fWriter->WriteIntoReservedBlob(sealedPageIt->fBuffer, sealedPageIt->fSize, offset);
          RNTupleLocator locator;
          locator.fPosition = offset;
          locator.fBytesOnStorage = sealedPageIt->fSize;
@@ -176,6 +178,67 @@ ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVImpl(std::span<RPa
    return locators;
 }
 
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Internal::RPageSinkFile::CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges)
+{
+   auto locators = ReserveSealedPageV(ranges);
+   if (locators.empty()) {
+      // Either there are no pages or they cannot fit into one key; in the latter case fall back to one key per page.
+      return RPagePersistentSink::CommitSealedPageVImpl(ranges);
+   }
+
+   Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+   unsigned i = 0;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         const auto &locator = locators[i++];
+         fWriter->WriteIntoReservedBlob(sealedPageIt->fBuffer, sealedPageIt->fSize,
+                                        locator.GetPosition<std::uint64_t>());
+      }
+   }
+
+   return locators;
+}
+
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Internal::RPageSinkFile::ReserveSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges,
+                                                                    std::function<void(void)> &writePayload)
+{
+   writePayload = nullptr;
+   if (!fWriter->CanWriteConcurrently())
+      return CommitSealedPageVImpl(ranges);
+
+   auto locators = ReserveSealedPageV(ranges);
+   if (locators.empty())
+      return RPagePersistentSink::CommitSealedPageVImpl(ranges);
+   // The key header of the reserved blob may still be buffered in the C file stream: write it out before the payload
+   // is written with positional writes, which bypass the stream.
+   fWriter->FlushStream();
+
+   struct RPendingWrite {
+      const void *fBuffer;
+      std::size_t fSize;
+      std::uint64_t fOffset;
+   };
+   std::vector<RPendingWrite> pendingWrites;
+   pendingWrites.reserve(locators.size());
+   unsigned i = 0;
+   for (auto &range : ranges) {
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         const auto offset = locators[i++].GetPosition<std::uint64_t>();
+         pendingWrites.push_back({sealedPageIt->fBuffer, sealedPageIt->fSize, offset});
+      }
+   }
+
+   // The byte ranges are reserved in the file, so the payload can be written without holding the sink guard.
+   writePayload = [this, pendingWrites = std::move(pendingWrites)]() {
+      Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+      for (const auto &w : pendingWrites)
+         fWriter->WriteIntoReservedBlobConcurrently(w.fBuffer, w.fSize, w.fOffset);
+   };
+   return locators;
+}
+
 std::uint64_t ROOT::Experimental::Internal::RPageSinkFile::CommitClusterImpl()
 {
    auto result = fNBytesCurrentCluster;
@@ -228,7 +291,8 @@ ROOT::Experimental::Internal::RPageSourceFile::RPageSourceFile(std::string_view
                                                                const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<RPagePool>()),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetMaxClusterBunchSize()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
@@ -333,6 +397,12 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Internal::RPageSourceF
    // For the page reads, we rely on the I/O scheduler to define the read requests
    fFile->SetBuffering(false);
 
+   if (fOptions.GetMemoryMap() == RNTupleReadOptions::EMemoryMap::kOn) {
+      fMappedFile = static_cast<const unsigned char *>(fFile->Map());
+      if (fMappedFile)
+         fMappedFileSize = fFile->GetSize();
+   }
+
    return desc;
 }
 
@@ -351,6 +421,7 @@ void ROOT::Experimental::Internal::RPageSourceFile::LoadSealedPage(DescriptorId_
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (!sealedPage.fBuffer)
       return;
    if (pageInfo.fLocator.fType != RNTupleLocator::kTypePageZero) {
@@ -386,6 +457,15 @@ ROOT::Experimental::Internal::RPageSourceFile::PopulatePageFromCluster(ColumnHan
       return pageZero;
    }
 
+   if (fMappedFile) {
+      auto mappedPage = MapPage(columnHandle, clusterInfo);
+      if (!mappedPage.IsNull()) {
+         fPagePool->RegisterPage(mappedPage, RPageDeleter([](const RPage &, void *) {}, nullptr));
+         fCounters->fNPageMapped.Inc();
+         return mappedPage;
+      }
+   }
+
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
       fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
@@ -404,8 +484,15 @@ ROOT::Experimental::Internal::RPageSourceFile::PopulatePageFromCluster(ColumnHan
 
       ROnDiskPage::Key key(columnId, pageInfo.fPageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
-      R__ASSERT(onDiskPage && (bytesOnStorage == onDiskPage->GetSize()));
-      sealedPageBuffer = onDiskPage->GetAddress();
+      if (onDiskPage) {
+         R__ASSERT(bytesOnStorage == onDiskPage->GetSize());
+         sealedPageBuffer = onDiskPage->GetAddress();
+      } else {
+         // Left out of the cluster because it is mappable, but this column's in-memory type differs from the on-disk
+         // one: unseal it from the mapping
+         R__ASSERT(fMappedFile);
+         sealedPageBuffer = fMappedFile + pageInfo.fLocator.GetPosition<std::uint64_t>();
+      }
    }
 
    RPage newPage;
@@ -423,6 +510,27 @@ ROOT::Experimental::Internal::RPageSourceFile::PopulatePageFromCluster(ColumnHan
    return newPage;
 }
 
+ROOT::Experimental::Internal::RPage
+ROOT::Experimental::Internal::RPageSourceFile::MapPage(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo)
+{
+   const auto &pageInfo = clusterInfo.fPageInfo;
+   const auto element = columnHandle.fColumn->GetElement();
+   const auto elementSize = element->GetSize();
+   const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+   const auto offset = pageInfo.fLocator.GetPosition<std::uint64_t>();
+
+   // Packed columns (e.g. split encoding or bit-packing) need to be unpacked into a separate buffer.
+   if (!element->IsMappable() || (bytesOnStorage != element->GetPackedPageSize(pageInfo.fNElements)) ||
+       !IsPageMappable(pageInfo, elementSize))
+      return RPage();
+
+   auto page = RPageAllocatorMmap::NewPage(columnHandle.fPhysicalId, fMappedFile + offset, elementSize,
+                                           pageInfo.fNElements);
+   page.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                  RPage::RClusterInfo(clusterInfo.fClusterId, clusterInfo.fColumnOffset));
+   return page;
+}
+
 ROOT::Experimental::Internal::RPage
 ROOT::Experimental::Internal::RPageSourceFile::PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
 {
@@ -488,6 +596,20 @@ std::unique_ptr<ROOT::Experimental::Internal::RPageSource> ROOT::Experimental::I
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
+bool ROOT::Experimental::Internal::RPageSourceFile::IsPageMappable(
+   const RClusterDescriptor::RPageRange::RPageInfo &pageInfo, std::size_t elementSize) const
+{
+   const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+   const auto offset = pageInfo.fLocator.GetPosition<std::uint64_t>();
+   // Compressed pages have a different size on storage
+   if (!fMappedFile || (pageInfo.fNElements == 0) || (bytesOnStorage != elementSize * pageInfo.fNElements))
+      return false;
+   if ((offset > fMappedFileSize) || (bytesOnStorage > fMappedFileSize - offset))
+      return false;
+   // Pages are not necessarily aligned in the file; the page buffer has to be suitably aligned for the element type
+   return reinterpret_cast<std::uintptr_t>(fMappedFile + offset) % elementSize == 0;
+}
+
 std::unique_ptr<ROOT::Experimental::Internal::RCluster>
 ROOT::Experimental::Internal::RPageSourceFile::PrepareSingleCluster(
    const RCluster::RKey &clusterKey, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
@@ -500,12 +622,28 @@ ROOT::Experimental::Internal::RPageSourceFile::PrepareSingleCluster(
       std::size_t fBufPos = 0;
    };
 
+   // With a memory-mapped file, the pages of mappable columns that MapPage() serves from the mapping are not read
+   std::unordered_map<DescriptorId_t, std::size_t> mappableElementSizes;
+   if (fMappedFile) {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      for (auto physicalColumnId : clusterKey.fPhysicalColumnSet) {
+         const auto element =
+            RColumnElementBase::Generate(descriptorGuard->GetColumnDescriptor(physicalColumnId).GetModel().GetType());
+         if (element->IsMappable())
+            mappableElementSizes[physicalColumnId] = element->GetSize();
+      }
+   }
+
    std::vector<ROnDiskPageLocator> onDiskPages;
    auto activeSize = 0;
    auto pageZeroMap = std::make_unique<ROnDiskPageMap>();
    PrepareLoadCluster(clusterKey, *pageZeroMap,
                       [&](DescriptorId_t physicalColumnId, NTupleSize_t pageNo,
                           const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) {
+                         const auto itMappable = mappableElementSizes.find(physicalColumnId);
+                         if ((itMappable != mappableElementSizes.end()) &&
+                             IsPageMappable(pageInfo, itMappable->second))
+                            return;
                          const auto &pageLocator = pageInfo.fLocator;
                          activeSize += pageLocator.fBytesOnStorage;
                          onDiskPages.push_back({physicalColumnId, pageNo, pageLocator.GetPosition<std::uint64_t>(),
@@ -613,6 +751,10 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::
    auto nReqs = readRequests.size();
    auto readvLimits = fFile->GetReadVLimits();
 
+   // Batches are submitted asynchronously so that, where supported, the vector reads of all batches are in flight
+   // at the same time
+   std::vector<std::unique_ptr<ROOT::Internal::RRawFile::RReadVHandle>> readVHandles;
+   Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
    int iReq = 0;
    while (nReqs > 0) {
       auto nBatch = std::min(nReqs, readvLimits.fMaxReqs);
@@ -635,11 +777,9 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::
 
       if (nBatch <= 1) {
          nBatch = 1;
-         Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
          fFile->ReadAt(readRequests[iReq].fBuffer, readRequests[iReq].fSize, readRequests[iReq].fOffset);
       } else {
-         Detail::RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-         fFile->ReadV(&readRequests[iReq], nBatch);
+         readVHandles.emplace_back(fFile->ReadVAsync(&readRequests[iReq], nBatch));
       }
       fCounters->fNReadV.Inc();
       fCounters->fNRead.Add(nBatch);
@@ -647,6 +787,8 @@ ROOT::Experimental::Internal::RPageSourceFile::LoadClusters(std::span<RCluster::
       iReq += nBatch;
       nReqs -= nBatch;
    }
+   for (auto &h : readVHandles)
+      h->Wait();
 
    return clusters;
 }
@@ -661,6 +803,18 @@ void ROOT::Experimental::Internal::RPageSourceFile::UnzipClusterImpl(RCluster *c
 
    std::vector<std::unique_ptr<RColumnElementBase>> allElements;
 
+   /// A single page to be unsealed by one of the unzip tasks
+   struct RUnzipItem {
+      const ROnDiskPage *fOnDiskPage = nullptr;
+      const RColumnElementBase *fElement = nullptr;
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      NTupleSize_t fIndexOffset = 0;
+      NTupleSize_t fFirstInPage = 0;
+      std::uint32_t fNElements = 0;
+   };
+   std::vector<RUnzipItem> unzipItems;
+   unzipItems.reserve(cluster->GetNOnDiskPages());
+
    const auto &columnsInCluster = cluster->GetAvailPhysicalColumns();
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
@@ -668,31 +822,57 @@ void ROOT::Experimental::Internal::RPageSourceFile::UnzipClusterImpl(RCluster *c
       allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
-         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
-
-         auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
-                          nElements = pi.fNElements,
-                          indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
-            fCounters->fSzUnzip.Add(element->GetSize() * nElements);
-
-            newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-            fPagePool->PreloadPage(
-               newPage, RPageDeleter([](const RPage &page, void *) { RPageAllocatorHeap::DeletePage(page); }, nullptr));
-         };
-
-         fTaskScheduler->AddTask(taskFunc);
+         // Pages left out of the cluster are served from the memory-mapped file
+         R__ASSERT(onDiskPage || fMappedFile);
+         if (onDiskPage) {
+            R__ASSERT(onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage);
+            unzipItems.push_back(
+               {onDiskPage, allElements.back().get(), columnId, indexOffset, firstInPage, pi.fNElements});
+         }
 
          firstInPage += pi.fNElements;
          pageNo++;
       } // for all pages in column
    } // for all columns in cluster
 
+   // The largest pages are processed first, so that the small pages at the end of the list balance the load among
+   // the tasks.  A few huge columns are thus spread over all tasks instead of keeping a single task busy.
+   std::stable_sort(unzipItems.begin(), unzipItems.end(), [](const RUnzipItem &a, const RUnzipItem &b) {
+      return a.fOnDiskPage->GetSize() > b.fOnDiskPage->GetSize();
+   });
+
+   // Instead of one task per page, a bounded number of tasks drains the list of pages.  That keeps the number of
+   // scheduled tasks small for clusters with many small pages.
+   std::atomic<std::size_t> idxNextItem{0};
+   auto taskFunc = [this, clusterId, &unzipItems, &idxNextItem]() {
+      const auto timeStart = std::chrono::steady_clock::now();
+      for (auto idx = idxNextItem++; idx < unzipItems.size(); idx = idxNextItem++) {
+         const auto &item = unzipItems[idx];
+         // The page buffer is allocated by the task that decompresses into it.  Its memory is thus first touched by
+         // the thread that uses it, which places the page on the thread's NUMA node.
+         auto newPage = UnsealPage({item.fOnDiskPage->GetAddress(), item.fOnDiskPage->GetSize(), item.fNElements},
+                                   *item.fElement, item.fColumnId);
+         fCounters->fSzUnzip.Add(item.fElement->GetSize() * item.fNElements);
+
+         newPage.SetWindow(item.fIndexOffset + item.fFirstInPage, RPage::RClusterInfo(clusterId, item.fIndexOffset));
+         fPagePool->PreloadPage(
+            newPage, RPageDeleter([](const RPage &page, void *) { RPageAllocatorHeap::DeletePage(page); }, nullptr));
+      }
+      fCounters->fTimeWallUnzipTasks.Add(
+         std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - timeStart).count());
+   };
+
+   // One task per thread of the pool that runs them; the pool may be smaller than the number of hardware threads.
+   const std::size_t nTasks = std::min<std::size_t>(unzipItems.size(), std::max(1u, ROOT::GetThreadPoolSize()));
+   for (std::size_t i = 0; i < nTasks; ++i)
+      fTaskScheduler->AddTask(taskFunc);
+
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
 
    fTaskScheduler->Wait();
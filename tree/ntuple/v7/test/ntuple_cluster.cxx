@@ -5,10 +5,12 @@
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RColumnModel.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleReader.hxx>
 #include <ROOT/RNTupleReadOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleWriteOptions.hxx>
 #include <ROOT/RNTupleWriter.hxx>
 #include <ROOT/RPage.hxx>
 #include <ROOT/RPageStorage.hxx>
@@ -18,6 +20,7 @@
 #include <ROOT/TThreadExecutor.hxx>
 #endif
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string_view>
@@ -49,6 +52,12 @@ public:
    std::string GetPath() const { return fPath; }
 };
 
+/**
+ * Simulated clock for the timings of the cluster pool: every thread has its own time that only advances when the test
+ * says so.  The cluster pool measures loading times on its I/O thread and processing times on the reader thread.
+ */
+thread_local std::chrono::steady_clock::time_point gSimulatedNow;
+
 /**
  * Used to track LoadClusters calls triggered by ClusterPool::GetCluster
  */
@@ -60,10 +69,13 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Internal::RCluster::ColumnSet_t> fReqsColumns;
+   /// Simulated latency of every LoadClusters() call, added to the simulated clock of the I/O thread
+   std::chrono::milliseconds fLoadDelay{0};
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   explicit RPageSourceMock(unsigned nClusters = 6) : RPageSource("test", ROOT::Experimental::RNTupleReadOptions())
+   {
       ROOT::Experimental::Internal::RNTupleDescriptorBuilder descBuilder;
-      for (unsigned i = 0; i <= 5; ++i) {
+      for (unsigned i = 0; i < nClusters; ++i) {
          descBuilder.AddCluster(ROOT::Experimental::Internal::RClusterDescriptorBuilder()
                                    .ClusterId(i)
                                    .FirstEntryIndex(i)
@@ -74,7 +86,7 @@ public:
       descBuilder.AddClusterGroup(ROOT::Experimental::Internal::RClusterGroupDescriptorBuilder()
                                      .ClusterGroupId(0)
                                      .MinEntry(0)
-                                     .EntrySpan(6)
+                                     .EntrySpan(nClusters)
                                      .MoveDescriptor()
                                      .Unwrap());
       auto descriptorGuard = GetExclDescriptorGuard();
@@ -87,6 +99,7 @@ public:
    void LoadSealedPage(ROOT::Experimental::DescriptorId_t, ROOT::Experimental::RClusterIndex, RSealedPage &) final {}
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
+      gSimulatedNow += fLoadDelay;
       std::vector<std::unique_ptr<RCluster>> result;
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
@@ -327,6 +340,103 @@ TEST(ClusterPool, GetClusterIncrementally)
    EXPECT_EQ(RCluster::ColumnSet_t({1}), p1.fReqsColumns[2]);
 }
 
+TEST(ClusterPool, AccessPatternStride)
+{
+   RPageSourceMock p1(12);
+   RClusterPool c1(p1, 1);
+   c1.GetCluster(0, {0});
+   c1.WaitForInFlightClusters();
+   EXPECT_EQ(1U, c1.GetStride());
+   // A single jump is not yet a pattern: load only the requested cluster
+   c1.GetCluster(3, {0});
+   c1.WaitForInFlightClusters();
+   EXPECT_EQ(0U, c1.GetStride());
+   // The second jump of the same distance establishes the stride
+   c1.GetCluster(6, {0});
+   c1.WaitForInFlightClusters();
+   EXPECT_EQ(3U, c1.GetStride());
+   ASSERT_EQ(5U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(1U, p1.fReqsClusterIds[1]);
+   EXPECT_EQ(3U, p1.fReqsClusterIds[2]);
+   EXPECT_EQ(6U, p1.fReqsClusterIds[3]);
+   // Clusters 7 and 8 are skipped
+   EXPECT_EQ(9U, p1.fReqsClusterIds[4]);
+
+   // Back to linear reading.  Note that WaitForInFlightClusters() discards the preloaded clusters.
+   c1.GetCluster(7, {0});
+   c1.WaitForInFlightClusters();
+   EXPECT_EQ(1U, c1.GetStride());
+   ASSERT_EQ(7U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(7U, p1.fReqsClusterIds[5]);
+   EXPECT_EQ(8U, p1.fReqsClusterIds[6]);
+}
+
+TEST(ClusterPool, AccessPatternIrregular)
+{
+   RPageSourceMock p1(12);
+   RClusterPool c1(p1, 2);
+   c1.GetCluster(0, {0});
+   c1.WaitForInFlightClusters();
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   c1.GetCluster(8, {0});
+   c1.WaitForInFlightClusters();
+   c1.GetCluster(5, {0});
+   c1.WaitForInFlightClusters();
+   c1.GetCluster(11, {0});
+   c1.WaitForInFlightClusters();
+   EXPECT_EQ(0U, c1.GetStride());
+   ASSERT_EQ(7U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(8U, p1.fReqsClusterIds[4]);
+   EXPECT_EQ(5U, p1.fReqsClusterIds[5]);
+   EXPECT_EQ(11U, p1.fReqsClusterIds[6]);
+}
+
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   // The adaptation is opt-in
+   ROOT::Experimental::RNTupleReadOptions options;
+   EXPECT_EQ(options.GetClusterBunchSize(), options.GetMaxClusterBunchSize());
+
+   // Loading a cluster takes 20 ms, processing it takes 1 ms
+   RPageSourceMock p1(12);
+   p1.fLoadDelay = std::chrono::milliseconds(20);
+   RClusterPool c1(p1, 1, 4);
+   c1.SetClock([]() { return gSimulatedNow; });
+   EXPECT_EQ(1U, c1.GetClusterBunchSize());
+   // Reading is much slower than processing, so the bunch size grows to the maximum
+   for (unsigned i = 0; i < 8; ++i) {
+      c1.GetCluster(i, {0});
+      gSimulatedNow += std::chrono::milliseconds(1);
+   }
+   EXPECT_EQ(4U, c1.GetClusterBunchSize());
+   c1.WaitForInFlightClusters();
+
+   // Processing is slower than reading, so the bunch size stays at the minimum
+   RPageSourceMock p2(12);
+   p2.fLoadDelay = std::chrono::milliseconds(1);
+   RClusterPool c2(p2, 1, 4);
+   c2.SetClock([]() { return gSimulatedNow; });
+   for (unsigned i = 0; i < 8; ++i) {
+      c2.GetCluster(i, {0});
+      gSimulatedNow += std::chrono::milliseconds(20);
+   }
+   EXPECT_EQ(1U, c2.GetClusterBunchSize());
+   c2.WaitForInFlightClusters();
+
+   // Without a maximum larger than the requested bunch size, the bunch size is fixed
+   RPageSourceMock p3(12);
+   p3.fLoadDelay = std::chrono::milliseconds(20);
+   RClusterPool c3(p3, 2);
+   c3.SetClock([]() { return gSimulatedNow; });
+   for (unsigned i = 0; i < 8; ++i) {
+      c3.GetCluster(i, {0});
+      gSimulatedNow += std::chrono::milliseconds(1);
+   }
+   EXPECT_EQ(2U, c3.GetClusterBunchSize());
+   c3.WaitForInFlightClusters();
+}
+
 
 TEST(PageStorageFile, LoadClusters)
 {
@@ -411,4 +521,49 @@ TEST(PageStorageFile, LoadClustersIMT)
 
    ROOT::DisableImplicitMT();
 }
+
+TEST(PageStorageFile, UnzipClusterIMT)
+{
+   ROOT::EnableImplicitMT(4);
+
+   FileRaii fileGuard("test_pagestoragefile_unzipclusterimt.root");
+
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrId = model->MakeField<std::uint64_t>("id");
+
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(512);
+      auto writer =
+         ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned i = 0; i < 10000; ++i) {
+         *wrPt = i;
+         *wrId = i;
+         writer->Fill();
+         if (i == 4999)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = ROOT::Experimental::RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   reader->EnableMetrics();
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewId = reader->GetView<std::uint64_t>("id");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(i, viewId(i));
+   }
+
+   const auto &metrics = reader->GetMetrics();
+   auto ctrTimeWallUnzipTasks = metrics.GetCounter("RNTupleReader.RPageSourceFile.timeWallUnzipTasks");
+   ASSERT_NE(nullptr, ctrTimeWallUnzipTasks);
+   EXPECT_GT(ctrTimeWallUnzipTasks->GetValueAsInt(), 0);
+   auto ctrParallelismUnzip = dynamic_cast<const ROOT::Experimental::Detail::RNTupleCalcPerf *>(
+      metrics.GetCounter("RNTupleReader.RPageSourceFile.rtParallelismUnzip"));
+   ASSERT_NE(nullptr, ctrParallelismUnzip);
+   EXPECT_GT(ctrParallelismUnzip->GetValue(), 0.);
+
+   ROOT::DisableImplicitMT();
+}
 #endif
@@ -461,6 +461,64 @@ TEST(RClusterDescriptor, GetBytesOnStorage)
    EXPECT_EQ(8 + 8 + 8 + 3, desc.GetClusterDescriptor(clusterID).GetBytesOnStorage());
 }
 
+TEST(RClusterDescriptor, ValueRanges)
+{
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldD = model->MakeField<double>("d");
+   auto fldJets = model->MakeField<std::vector<float>>("jets");
+
+   FileRaii fileGuard("test_descriptor_value_ranges.root");
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *fldPt = i;
+         *fldD = (i == 0) ? std::numeric_limits<double>::quiet_NaN() : -i;
+         fldJets->assign({1.f, 2.f});
+         writer->Fill();
+         if (i == 49)
+            writer->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+   const auto dColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("d"), 0);
+   const auto jetsColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("jets"), 0);
+   ASSERT_EQ(2u, desc.GetNClusters());
+
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+      const auto lastEntry = firstEntry + clusterDesc.GetNEntries() - 1;
+
+      const auto &ptRange = clusterDesc.GetColumnRange(ptColumnId);
+      ASSERT_TRUE(ptRange.fValueRange);
+      EXPECT_DOUBLE_EQ(firstEntry, ptRange.fValueRange->fMin);
+      EXPECT_DOUBLE_EQ(lastEntry, ptRange.fValueRange->fMax);
+      const auto &ptPages = clusterDesc.GetPageRange(ptColumnId).fPageInfos;
+      EXPECT_GT(ptPages.size(), 1u);
+      auto firstInPage = firstEntry;
+      for (const auto &pi : ptPages) {
+         ASSERT_TRUE(pi.fValueRange);
+         EXPECT_DOUBLE_EQ(firstInPage, pi.fValueRange->fMin);
+         EXPECT_DOUBLE_EQ(firstInPage + pi.fNElements - 1, pi.fValueRange->fMax);
+         firstInPage += pi.fNElements;
+      }
+
+      // NaN values are ignored
+      const auto &dRange = clusterDesc.GetColumnRange(dColumnId);
+      ASSERT_TRUE(dRange.fValueRange);
+      EXPECT_DOUBLE_EQ(-static_cast<double>(lastEntry), dRange.fValueRange->fMin);
+      EXPECT_DOUBLE_EQ(-std::max(1.0, static_cast<double>(firstEntry)), dRange.fValueRange->fMax);
+
+      // Offset columns have no value range
+      EXPECT_FALSE(clusterDesc.GetColumnRange(jetsColumnId).fValueRange);
+   }
+}
+
 TEST(RNTupleDescriptor, Clone)
 {
    auto model = RNTupleModel::Create();
@@ -6,6 +6,7 @@
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 template <typename PodT, typename NarrowT, ROOT::Experimental::EColumnType ColumnT>
 struct Helper {
@@ -39,6 +40,12 @@ public:
    using Helper_t = HelperT;
 };
 
+template <typename HelperT>
+class PackingBitPacked : public ::testing::Test {
+public:
+   using Helper_t = HelperT;
+};
+
 using PackingRealTypes = ::testing::Types<Helper<double, double, ROOT::Experimental::EColumnType::kSplitReal64>,
                                           Helper<float, float, ROOT::Experimental::EColumnType::kSplitReal32>>;
 TYPED_TEST_SUITE(PackingReal, PackingRealTypes);
@@ -57,6 +64,16 @@ using PackingIndexTypes = ::testing::Types<
    Helper<ROOT::Experimental::ClusterSize_t, std::uint64_t, ROOT::Experimental::EColumnType::kSplitIndex64>>;
 TYPED_TEST_SUITE(PackingIndex, PackingIndexTypes);
 
+using PackingBitPackedTypes =
+   ::testing::Types<Helper<std::int64_t, std::int64_t, ROOT::Experimental::EColumnType::kBitPackedInt64>,
+                    Helper<std::uint64_t, std::uint64_t, ROOT::Experimental::EColumnType::kBitPackedUInt64>,
+                    Helper<std::int64_t, std::int32_t, ROOT::Experimental::EColumnType::kBitPackedInt32>,
+                    Helper<std::int32_t, std::int32_t, ROOT::Experimental::EColumnType::kBitPackedInt32>,
+                    Helper<std::uint32_t, std::uint32_t, ROOT::Experimental::EColumnType::kBitPackedUInt32>,
+                    Helper<std::int16_t, std::int16_t, ROOT::Experimental::EColumnType::kBitPackedInt16>,
+                    Helper<std::uint16_t, std::uint16_t, ROOT::Experimental::EColumnType::kBitPackedUInt16>>;
+TYPED_TEST_SUITE(PackingBitPacked, PackingBitPackedTypes);
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Internal::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element;
@@ -179,6 +196,68 @@ TYPED_TEST(PackingInt, SplitInt)
    EXPECT_EQ(mem, cmp);
 }
 
+TYPED_TEST(PackingBitPacked, BitPackInt)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+   using Narrow_t = typename TestFixture::Helper_t::Narrow_t;
+
+   ROOT::Experimental::Internal::RColumnElement<Pod_t, TestFixture::Helper_t::kColumnType> element;
+   EXPECT_EQ(1 + sizeof(Narrow_t), element.GetPageHeaderSize());
+   EXPECT_EQ(1u, element.GetUnzippedPageHeaderSize());
+
+   // Full range: every element needs the full width
+   std::array<Pod_t, 9> mem{0, std::is_signed_v<Pod_t> ? -42 : 1, 42, std::numeric_limits<Narrow_t>::min(),
+                            std::numeric_limits<Narrow_t>::min() + 1, std::numeric_limits<Narrow_t>::min() + 2,
+                            std::numeric_limits<Narrow_t>::max(), std::numeric_limits<Narrow_t>::max() - 1,
+                            std::numeric_limits<Narrow_t>::max() - 2};
+   std::vector<unsigned char> packed(element.GetPackedPageSize(9));
+   std::array<Pod_t, 9> cmp;
+
+   element.Pack(packed.data(), mem.data(), 9);
+   EXPECT_EQ(8 * sizeof(Narrow_t), packed[0]);
+   EXPECT_EQ(element.GetPackedPageSize(9), element.GetPackedPageSize(packed.data(), 9));
+   EXPECT_EQ(element.GetPackedPageSize(9), ROOT::Experimental::Internal::RColumnElementBase::GetPackedPageSize(
+                                              TestFixture::Helper_t::kColumnType, packed.data(), 9));
+   element.Unpack(cmp.data(), packed.data(), 9);
+   EXPECT_EQ(mem, cmp);
+
+   // Small range around a large frame of reference: 5 bits per element
+   std::array<Pod_t, 9> small;
+   for (std::size_t i = 0; i < small.size(); ++i)
+      small[i] = std::numeric_limits<Narrow_t>::max() - 3 * i;
+   element.Pack(packed.data(), small.data(), 9);
+   EXPECT_EQ(5, packed[0]);
+   // The page only takes the bits of its elements
+   EXPECT_EQ(1 + sizeof(Narrow_t) + 6, element.GetPackedPageSize(packed.data(), 9));
+   element.Unpack(cmp.data(), packed.data(), 9);
+   EXPECT_EQ(small, cmp);
+
+   // Constant page: zero bits per element
+   std::array<Pod_t, 9> constant;
+   constant.fill(42);
+   element.Pack(packed.data(), constant.data(), 9);
+   EXPECT_EQ(0, packed[0]);
+   EXPECT_EQ(1 + sizeof(Narrow_t), element.GetPackedPageSize(packed.data(), 9));
+   element.Unpack(cmp.data(), packed.data(), 9);
+   EXPECT_EQ(constant, cmp);
+}
+
+TEST(Packing, BitPackedIndex)
+{
+   ROOT::Experimental::Internal::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kBitPackedIndex32>
+      element;
+
+   // Offsets of collections with 0 to 3 items are stored as 2 bit deltas
+   std::array<std::uint64_t, 6> mem{3, 3, 5, 6, 9, 9};
+   std::vector<unsigned char> packed(element.GetPackedPageSize(mem.size()));
+   std::array<std::uint64_t, 6> cmp;
+
+   element.Pack(packed.data(), mem.data(), mem.size());
+   EXPECT_EQ(2, packed[0]);
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+   EXPECT_EQ(mem, cmp);
+}
+
 TYPED_TEST(PackingIndex, SplitIndex)
 {
    using Pod_t = typename TestFixture::Helper_t::Pod_t;
@@ -334,3 +413,83 @@ TEST(Packing, OnDiskEncoding)
    EXPECT_EQ(std::string("abc"), viewStr(0));
    EXPECT_EQ(std::string("de"), viewStr(1));
 }
+
+TEST(Packing, BitPackedColumns)
+{
+   FileRaii fileGuard("test_ntuple_packing_bitpacked.root");
+
+   auto model = RNTupleModel::Create();
+   AddField<std::int16_t, ROOT::Experimental::EColumnType::kBitPackedInt16>(*model, "int16");
+   AddField<std::uint32_t, ROOT::Experimental::EColumnType::kBitPackedUInt32>(*model, "uint32");
+   AddField<std::int64_t, ROOT::Experimental::EColumnType::kBitPackedInt64>(*model, "int64");
+   auto fldVec = std::make_unique<RField<std::vector<float>>>("vec");
+   fldVec->SetColumnRepresentative({ROOT::Experimental::EColumnType::kBitPackedIndex64});
+   model->AddField(std::move(fldVec));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto e = writer->CreateEntry();
+      for (int i = 0; i < 1000; ++i) {
+         *e->GetPtr<std::int16_t>("int16") = -500 + i;
+         *e->GetPtr<std::uint32_t>("uint32") = 0xFFFFFFF0u - (i % 7);
+         *e->GetPtr<std::int64_t>("int64") = std::numeric_limits<std::int64_t>::min() + i;
+         e->GetPtr<std::vector<float>>("vec")->assign(i % 5, 1.0);
+         writer->Fill(*e);
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(EColumnType::kBitPackedIndex64, reader->GetModel().GetField("vec").GetColumnRepresentative()[0]);
+   EXPECT_EQ(EColumnType::kBitPackedUInt32, reader->GetModel().GetField("uint32").GetColumnRepresentative()[0]);
+   auto viewInt16 = reader->GetView<std::int16_t>("int16");
+   auto viewUInt32 = reader->GetView<std::uint32_t>("uint32");
+   auto viewInt64 = reader->GetView<std::int64_t>("int64");
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(-500 + static_cast<int>(i), viewInt16(i));
+      EXPECT_EQ(0xFFFFFFF0u - (i % 7), viewUInt32(i));
+      EXPECT_EQ(std::numeric_limits<std::int64_t>::min() + static_cast<std::int64_t>(i), viewInt64(i));
+      EXPECT_EQ(i % 5, viewVec(i).size());
+   }
+}
+
+TEST(Packing, BitPackedPageSize)
+{
+   FileRaii fileGuard("test_ntuple_packing_bitpacked_pagesize.root");
+
+   auto model = RNTupleModel::Create();
+   AddField<std::int32_t, ROOT::Experimental::EColumnType::kInt32>(*model, "plain");
+   AddField<std::int32_t, ROOT::Experimental::EColumnType::kBitPackedInt32>(*model, "packed");
+   {
+      // Without compression, the pages only shrink if they are sealed at the size of their bit-packed elements
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      auto e = writer->CreateEntry();
+      for (int i = 0; i < 10000; ++i) {
+         *e->GetPtr<std::int32_t>("plain") = 1000000 + i % 100;
+         *e->GetPtr<std::int32_t>("packed") = 1000000 + i % 100;
+         writer->Fill(*e);
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   auto getBytesOnStorage = [&desc](const std::string &fieldName) {
+      const auto columnId = desc.FindPhysicalColumnId(desc.FindFieldId(fieldName), 0);
+      std::uint64_t nBytes = 0;
+      for (const auto &cluster : desc.GetClusterIterable()) {
+         for (const auto &pageInfo : cluster.GetPageRange(columnId).fPageInfos)
+            nBytes += pageInfo.fLocator.fBytesOnStorage;
+      }
+      return nBytes;
+   };
+   const auto plainBytes = getBytesOnStorage("plain");
+   const auto packedBytes = getBytesOnStorage("packed");
+   EXPECT_EQ(10000u * sizeof(std::int32_t), plainBytes);
+   // 7 bits per element, plus the page headers
+   EXPECT_LT(packedBytes, plainBytes / 4);
+
+   auto viewPacked = reader->GetView<std::int32_t>("packed");
+   for (auto i : reader->GetEntryRange())
+      EXPECT_EQ(1000000 + static_cast<int>(i % 100), viewPacked(i));
+}
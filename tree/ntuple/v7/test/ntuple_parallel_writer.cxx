@@ -104,3 +104,55 @@ TEST(RNTupleParallelWriter, Options)
       EXPECT_THAT(err.what(), testing::HasSubstr("parallel writing requires buffering"));
    }
 }
+
+TEST(RNTupleParallelWriter, ConcurrentContexts)
+{
+   FileRaii fileGuard("test_ntuple_parallel_concurrent.root");
+
+   static constexpr int kNThreads = 4;
+   static constexpr int kNEntriesPerThread = 1000;
+   {
+      auto model = RNTupleModel::CreateBare();
+      model->MakeField<std::int32_t>("id");
+      model->MakeField<std::vector<float>>("vec");
+
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t] {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            auto id = entry->GetPtr<std::int32_t>("id");
+            auto vec = entry->GetPtr<std::vector<float>>("vec");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *id = t * kNEntriesPerThread + i;
+               *vec = std::vector<float>(i % 5, static_cast<float>(*id));
+               context->Fill(*entry);
+               if (i % 100 == 99)
+                  context->CommitCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto reader = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread, reader->GetNEntries());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread / 100, reader->GetDescriptor().GetNClusters());
+
+   auto id = reader->GetModel().GetDefaultEntry().GetPtr<std::int32_t>("id");
+   auto vec = reader->GetModel().GetDefaultEntry().GetPtr<std::vector<float>>("vec");
+   std::vector<bool> seen(kNThreads * kNEntriesPerThread, false);
+   for (auto i : reader->GetEntryRange()) {
+      reader->LoadEntry(i);
+      ASSERT_GE(*id, 0);
+      ASSERT_LT(*id, kNThreads * kNEntriesPerThread);
+      EXPECT_FALSE(seen[*id]);
+      seen[*id] = true;
+      ASSERT_EQ(static_cast<std::size_t>((*id % kNEntriesPerThread) % 5), vec->size());
+      for (auto v : *vec)
+         EXPECT_FLOAT_EQ(static_cast<float>(*id), v);
+   }
+}
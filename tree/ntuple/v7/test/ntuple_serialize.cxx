@@ -760,3 +760,70 @@ TEST(RNTuple, SerializeFooterXHeader)
    }
    EXPECT_EQ(2U, counter);
 }
+
+TEST(RNTuple, SerializePageValueRanges)
+{
+   RNTupleDescriptorBuilder builder;
+   builder.SetNTuple("ntpl", "");
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(0).FieldName("").Structure(ENTupleStructure::kRecord).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(42).FieldName("pt").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 42);
+   builder.AddColumn(17, 17, 42, RColumnModel(EColumnType::kReal32, false), 0);
+
+   RClusterDescriptorBuilder clusterBuilder;
+   clusterBuilder.ClusterId(84).FirstEntryIndex(0).NEntries(30);
+   ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+   pageRange.fPhysicalColumnId = 17;
+   ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = 10;
+   pageInfo.fLocator.fPosition = 7000U;
+   pageInfo.fValueRange = ROOT::Experimental::RColumnValueRange{1.0, 2.0};
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   pageInfo.fLocator.fPosition = 8000U;
+   pageInfo.fValueRange.reset();
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   pageInfo.fLocator.fPosition = 9000U;
+   pageInfo.fValueRange = ROOT::Experimental::RColumnValueRange{-5.0, 7.5};
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   clusterBuilder.CommitColumnRange(17, 0, 0, pageRange);
+   builder.AddCluster(clusterBuilder.MoveDescriptor().Unwrap());
+   RClusterGroupDescriptorBuilder cgBuilder;
+   cgBuilder.ClusterGroupId(256).NClusters(1).EntrySpan(30);
+   std::vector<DescriptorId_t> clusterIds{84};
+   cgBuilder.AddClusters(clusterIds);
+   builder.AddClusterGroup(cgBuilder.MoveDescriptor().Unwrap());
+
+   auto desc = builder.MoveDescriptor();
+   EXPECT_FALSE(desc.GetClusterDescriptor(84).GetColumnRange(17).fValueRange);
+   auto context = RNTupleSerializer::SerializeHeader(nullptr, desc);
+   auto bufHeader = std::make_unique<unsigned char[]>(context.GetHeaderSize());
+   context = RNTupleSerializer::SerializeHeader(bufHeader.get(), desc);
+
+   std::vector<DescriptorId_t> physClusterIDs{context.MapClusterId(84)};
+   context.MapClusterGroupId(256);
+   auto sizePageList = RNTupleSerializer::SerializePageList(nullptr, desc, physClusterIDs, context);
+   auto bufPageList = std::make_unique<unsigned char[]>(sizePageList);
+   EXPECT_EQ(sizePageList, RNTupleSerializer::SerializePageList(bufPageList.get(), desc, physClusterIDs, context));
+   auto sizeFooter = RNTupleSerializer::SerializeFooter(nullptr, desc, context);
+   auto bufFooter = std::make_unique<unsigned char[]>(sizeFooter);
+   EXPECT_EQ(sizeFooter, RNTupleSerializer::SerializeFooter(bufFooter.get(), desc, context));
+
+   RNTupleSerializer::DeserializeHeader(bufHeader.get(), context.GetHeaderSize(), builder);
+   RNTupleSerializer::DeserializeFooter(bufFooter.get(), sizeFooter, builder);
+   desc = builder.MoveDescriptor();
+   RNTupleSerializer::DeserializePageList(bufPageList.get(), sizePageList, 0, desc);
+
+   const auto &clusterDesc = desc.GetClusterDescriptor(0);
+   EXPECT_FALSE(clusterDesc.GetColumnRange(0).fValueRange);
+   const auto &pageInfos = clusterDesc.GetPageRange(0).fPageInfos;
+   ASSERT_EQ(3u, pageInfos.size());
+   ASSERT_TRUE(pageInfos[0].fValueRange);
+   EXPECT_DOUBLE_EQ(1.0, pageInfos[0].fValueRange->fMin);
+   EXPECT_DOUBLE_EQ(2.0, pageInfos[0].fValueRange->fMax);
+   EXPECT_FALSE(pageInfos[1].fValueRange);
+   ASSERT_TRUE(pageInfos[2].fValueRange);
+   EXPECT_DOUBLE_EQ(-5.0, pageInfos[2].fValueRange->fMin);
+   EXPECT_DOUBLE_EQ(7.5, pageInfos[2].fValueRange->fMax);
+}
@@ -315,6 +315,101 @@ TEST(RNTuple, TMemFile)
    EXPECT_EQ(*pt, 42.0);
 }
 
+TEST(RPageSourceFile, MemoryMap)
+{
+   FileRaii fileGuard("test_ntuple_memory_map.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = std::make_unique<RField<float>>("pt");
+      fldPt->SetColumnRepresentative({ROOT::Experimental::EColumnType::kReal32});
+      model->AddField(std::move(fldPt));
+      auto fldId = std::make_unique<RField<std::int64_t>>("id");
+      fldId->SetColumnRepresentative({ROOT::Experimental::EColumnType::kInt64});
+      model->AddField(std::move(fldId));
+      // Byte-sized elements are always suitably aligned in the mapped file
+      model->MakeField<std::uint8_t>("flag");
+      // Split encoded columns need to be unpacked and cannot be served from the mapping
+      model->MakeField<float>("eta");
+
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetApproxUnzippedPageSize(512);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      auto entry = writer->CreateEntry();
+      for (unsigned i = 0; i < 1000; ++i) {
+         *entry->GetPtr<float>("pt") = i;
+         *entry->GetPtr<std::int64_t>("id") = -static_cast<std::int64_t>(i);
+         *entry->GetPtr<std::uint8_t>("flag") = i % 256;
+         *entry->GetPtr<float>("eta") = 2 * i;
+         writer->Fill(*entry);
+         if (i == 499)
+            writer->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetMemoryMap(RNTupleReadOptions::EMemoryMap::kOn);
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      reader->EnableMetrics();
+      auto viewPt = reader->GetView<float>("pt");
+      auto viewId = reader->GetView<std::int64_t>("id");
+      auto viewFlag = reader->GetView<std::uint8_t>("flag");
+      auto viewEta = reader->GetView<float>("eta");
+      for (auto i : reader->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(-static_cast<std::int64_t>(i), viewId(i));
+         EXPECT_EQ(i % 256, viewFlag(i));
+         EXPECT_FLOAT_EQ(static_cast<float>(2 * i), viewEta(i));
+      }
+
+      const auto &metrics = reader->GetMetrics();
+      auto ctrMapped = metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageMapped");
+      auto ctrPopulated = metrics.GetCounter("RNTupleReader.RPageSourceFile.nPagePopulated");
+      ASSERT_NE(nullptr, ctrMapped);
+      ASSERT_NE(nullptr, ctrPopulated);
+      EXPECT_GT(ctrMapped->GetValueAsInt(), 0);
+      EXPECT_GT(ctrPopulated->GetValueAsInt(), 0);
+   }
+
+   // Reading a mapped column along with a split encoded one: only the pages of the latter are read into the clusters
+   {
+      RNTupleReadOptions options;
+      options.SetMemoryMap(RNTupleReadOptions::EMemoryMap::kOn);
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      reader->EnableMetrics();
+      auto viewFlag = reader->GetView<std::uint8_t>("flag");
+      auto viewEta = reader->GetView<float>("eta");
+      for (auto i : reader->GetEntryRange()) {
+         EXPECT_EQ(i % 256, viewFlag(i));
+         EXPECT_FLOAT_EQ(static_cast<float>(2 * i), viewEta(i));
+      }
+
+      const auto &desc = reader->GetDescriptor();
+      const auto flagColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("flag"), 0);
+      const auto etaColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("eta"), 0);
+      std::int64_t nFlagPages = 0;
+      std::int64_t szEtaPages = 0;
+      for (const auto &clusterDesc : desc.GetClusterIterable()) {
+         nFlagPages += clusterDesc.GetPageRange(flagColumnId).fPageInfos.size();
+         for (const auto &pageInfo : clusterDesc.GetPageRange(etaColumnId).fPageInfos)
+            szEtaPages += pageInfo.fLocator.fBytesOnStorage;
+      }
+      const auto &metrics = reader->GetMetrics();
+      EXPECT_EQ(nFlagPages, metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageMapped")->GetValueAsInt());
+      EXPECT_EQ(szEtaPages, metrics.GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt());
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   reader->EnableMetrics();
+   auto viewFlag = reader->GetView<std::uint8_t>("flag");
+   for (auto i : reader->GetEntryRange())
+      EXPECT_EQ(i % 256, viewFlag(i));
+   EXPECT_EQ(0, reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped")->GetValueAsInt());
+}
+
 TEST(RPageSinkBuf, Basics)
 {
    struct TestModel {
@@ -501,6 +596,46 @@ TEST(RPageSinkBuf, ParallelZipIMT)
 
    ROOT::DisableImplicitMT();
 }
+
+TEST(RPageSinkBuf, MaxInFlightPageBytes)
+{
+   ROOT::EnableImplicitMT(2);
+
+   FileRaii fileGuard("test_ntuple_sinkbuf_inflight.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrId = model->MakeField<std::uint64_t>("id");
+
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      // Only a single page at a time is sealed by a background task
+      options.SetMaxInFlightPageBytes(1);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      writer->EnableMetrics();
+      for (unsigned i = 0; i < 10000; ++i) {
+         *wrPt = i;
+         *wrId = i;
+         writer->Fill();
+         if (i % 2500 == 2499)
+            writer->CommitCluster();
+      }
+      auto *ctrInline = writer->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.nPageSealedInline");
+      ASSERT_NE(nullptr, ctrInline);
+      EXPECT_GT(ctrInline->GetValueAsInt(), 0);
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(10000u, reader->GetNEntries());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewId = reader->GetView<std::uint64_t>("id");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(i, viewId(i));
+   }
+
+   ROOT::DisableImplicitMT();
+}
 #endif
 
 TEST(RPageSinkBuf, CommitSealedPageV)
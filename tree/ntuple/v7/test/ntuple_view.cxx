@@ -131,6 +131,64 @@ TEST(RNTuple, BulkCollectionView)
    }
 }
 
+TEST(RNTuple, ReadBulkView)
+{
+   FileRaii fileGuard("test_ntuple_read_bulk_view.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldVec = model->MakeField<ROOT::RVec<float>>("vec");
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(100 * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 1000; i++) {
+         *fieldPt = i;
+         *fieldVec = ROOT::RVec<float>(i % 3, i);
+         ntuple->Fill();
+         if (i == 499)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<ROOT::RVec<float>>("vec");
+
+   EXPECT_TRUE(viewPt.ReadBulk(RClusterIndex(0, 0), 0).empty());
+
+   // Within a single page, the span points into the page
+   NTupleSize_t nPageItems = 0;
+   const float *page = viewPt.MapV(RClusterIndex(0, 0), nPageItems);
+   ASSERT_GT(nPageItems, 10u);
+   auto pts = viewPt.ReadBulk(RClusterIndex(0, 0), 10);
+   EXPECT_EQ(page, pts.data());
+   ASSERT_EQ(10u, pts.size());
+   for (std::size_t i = 0; i < pts.size(); ++i)
+      EXPECT_FLOAT_EQ(static_cast<float>(i), pts[i]);
+
+   // Ranges spanning several pages are copied into a contiguous buffer
+   auto ptsCluster = viewPt.ReadBulk(ROOT::Experimental::RNTupleClusterRange(1, 0, 500));
+   ASSERT_EQ(500u, ptsCluster.size());
+   for (std::size_t i = 0; i < ptsCluster.size(); ++i)
+      EXPECT_FLOAT_EQ(static_cast<float>(500 + i), ptsCluster[i]);
+
+   auto mask = std::make_unique<bool[]>(500);
+   for (unsigned int i = 0; i < 500; ++i)
+      mask[i] = (i % 2 == 0);
+   auto vecs = viewVec.ReadBulk(RClusterIndex(1, 0), 500, mask.get());
+   ASSERT_EQ(500u, vecs.size());
+   for (std::size_t i = 0; i < vecs.size(); i += 2) {
+      ASSERT_EQ((500 + i) % 3, vecs[i].size());
+      for (auto v : vecs[i])
+         EXPECT_FLOAT_EQ(static_cast<float>(500 + i), v);
+   }
+
+   auto vecsAll = viewVec.ReadBulk(ROOT::Experimental::RNTupleClusterRange(0, 100, 200));
+   ASSERT_EQ(100u, vecsAll.size());
+   for (std::size_t i = 0; i < vecsAll.size(); ++i)
+      EXPECT_EQ((100 + i) % 3, vecsAll[i].size());
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
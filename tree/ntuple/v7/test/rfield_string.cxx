@@ -27,3 +27,100 @@ TEST(RNTuple, ReadString)
    int nElementsPerPage = ntuple->GetDescriptor().GetClusterDescriptor(0).GetPageRange(1).fPageInfos.at(1).fNElements;
    EXPECT_EQ(contentString, viewSt(nElementsPerPage/7));
 }
+
+TEST(RNTuple, DictionaryString)
+{
+   FileRaii fileGuard("test_ntuple_dictionary_string.root");
+   const std::vector<std::string> triggers = {"HLT_Mu", "HLT_Ele", "", "HLT_Mu", "HLT_Jet"};
+   {
+      auto model = RNTupleModel::Create();
+      auto trigger = model->MakeField<std::string>("trigger");
+      auto fldSmall = std::make_unique<RField<std::string>>("small");
+      fldSmall->SetColumnRepresentative(
+         {EColumnType::kUInt32, EColumnType::kIndex32, EColumnType::kChar});
+      model->AddField(std::move(fldSmall));
+      auto small = model->GetDefaultEntry().GetPtr<std::string>("small");
+      RNTupleWriteOptions options;
+      options.SetUseDictionaryEncoding(true);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned i = 0; i < 100; ++i) {
+         *trigger = triggers[i % triggers.size()];
+         *small = std::to_string(i % 2);
+         writer->Fill();
+         if (i == 49)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   const auto fieldId = desc.FindFieldId("trigger");
+   EXPECT_NE(ROOT::Experimental::kInvalidDescriptorId, desc.FindPhysicalColumnId(fieldId, 2));
+   // Only the distinct values are stored in the dictionary of every cluster
+   const auto dictColumnId = desc.FindPhysicalColumnId(fieldId, 1);
+   EXPECT_EQ(4u, desc.GetClusterDescriptor(0).GetColumnRange(dictColumnId).fNElements);
+   EXPECT_EQ(4u, desc.GetClusterDescriptor(1).GetColumnRange(dictColumnId).fNElements);
+
+   auto viewTrigger = reader->GetView<std::string>("trigger");
+   auto viewSmall = reader->GetView<std::string>("small");
+   EXPECT_TRUE(viewTrigger.GetField().IsDictionaryEncoded());
+   EXPECT_TRUE(viewSmall.GetField().IsDictionaryEncoded());
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(triggers[i % triggers.size()], viewTrigger(i));
+      EXPECT_EQ(std::to_string(i % 2), viewSmall(i));
+   }
+
+   // Codes are equal for equal values within a cluster
+   const auto &fieldTrigger = viewTrigger.GetField();
+   EXPECT_EQ(fieldTrigger.GetDictionaryIndex(0), fieldTrigger.GetDictionaryIndex(3));
+   EXPECT_NE(fieldTrigger.GetDictionaryIndex(0), fieldTrigger.GetDictionaryIndex(1));
+   EXPECT_EQ(fieldTrigger.GetDictionaryIndex(RClusterIndex(1, 0)), fieldTrigger.GetDictionaryIndex(50));
+   EXPECT_EQ(1u, fieldTrigger.GetDictionaryIndex(50).GetClusterId());
+   std::string value;
+   fieldTrigger.ReadDictionaryEntry(fieldTrigger.GetDictionaryIndex(52), value);
+   EXPECT_EQ("", value);
+   fieldTrigger.ReadDictionaryEntry(fieldTrigger.GetDictionaryIndex(54), value);
+   EXPECT_EQ("HLT_Jet", value);
+
+   FileRaii fileGuardPlain("test_ntuple_dictionary_string_plain.root");
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<std::string>("trigger") = "HLT_Mu";
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuardPlain.GetPath());
+      writer->Fill();
+   }
+   reader = RNTupleReader::Open("ntpl", fileGuardPlain.GetPath());
+   auto viewPlain = reader->GetView<std::string>("trigger");
+   EXPECT_FALSE(viewPlain.GetField().IsDictionaryEncoded());
+   EXPECT_EQ("HLT_Mu", viewPlain(0));
+   EXPECT_THROW(viewPlain.GetField().GetDictionaryIndex(0), RException);
+
+   // Without compression, the dictionary-encoded columns are not split
+   FileRaii fileGuardUncompressed("test_ntuple_dictionary_string_uncompressed.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto trigger = model->MakeField<std::string>("trigger");
+      RNTupleWriteOptions options;
+      options.SetUseDictionaryEncoding(true);
+      options.SetCompression(0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuardUncompressed.GetPath(), options);
+      for (const auto &t : triggers) {
+         *trigger = t;
+         writer->Fill();
+      }
+   }
+   reader = RNTupleReader::Open("ntpl", fileGuardUncompressed.GetPath());
+   const auto &descUncompressed = reader->GetDescriptor();
+   const auto fieldIdUncompressed = descUncompressed.FindFieldId("trigger");
+   const auto typeOf = [&](std::uint32_t columnIndex) {
+      const auto columnId = descUncompressed.FindPhysicalColumnId(fieldIdUncompressed, columnIndex);
+      return descUncompressed.GetColumnDescriptor(columnId).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kUInt32, typeOf(0));
+   EXPECT_EQ(EColumnType::kIndex64, typeOf(1));
+   EXPECT_EQ(EColumnType::kChar, typeOf(2));
+   auto viewUncompressed = reader->GetView<std::string>("trigger");
+   EXPECT_TRUE(viewUncompressed.GetField().IsDictionaryEncoded());
+   for (auto i : reader->GetEntryRange())
+      EXPECT_EQ(triggers[i], viewUncompressed(i));
+}
@@ -27,6 +27,8 @@
 
 #include "TKey.h"
 
+#include <vector>
+
 class TFile;
 class TTree;
 class TBranch;
@@ -44,6 +46,7 @@ private:
 
    // Helper for managing the compressed buffer.
    void InitializeCompressedBuffer(Int_t len, TFile* file);
+   void DetachCompressedBuffer();
 
    // Handles special logic around deleting / reseting the entry offset pointer.
    void ResetEntryOffset();
@@ -58,6 +61,27 @@ private:
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
 
+   // The stages of WriteBuffer; only CompressBuffer can run concurrently with the use of the file.
+   void   PrepareBufferForWrite();
+   Int_t  CompressBuffer(TFile *file);
+   Int_t  WriteCompressedBuffer(Int_t nzip, Int_t cycle, TFile *file);
+   Int_t  FinishWriteBuffer(Int_t nzip, Int_t cycle);
+
+   // A compressed block of the object, for the baskets decompressed on demand (see DecompressEntry).
+   struct RZipBlock {
+      Int_t fIn;   ///< Position of the compressed block in fZipData
+      Int_t fNin;  ///< Size of the compressed block
+      Int_t fOut;  ///< Position of the block in fBufferRef
+      Int_t fNout; ///< Size of the block once decompressed
+      bool  fDone; ///< True once the block is decompressed in fBufferRef
+   };
+
+   // Decompression of the blocks of the object on demand.
+   bool   InitializeZipBlocks(const char *rawCompressedBuffer);
+   bool   DecompressRange(Int_t begin, Int_t end);
+   bool   DecompressAllBlocks() { return fZipBlocks.empty() || DecompressRange(fKeylen, fKeylen + fObjlen); }
+   void   ResetZipBlocks();
+
 protected:
    Int_t       fBufferSize{0};                    ///< fBuffer length in bytes
    Int_t       fNevBufSize{0};                    ///< Length in Int_t of fEntryOffset OR fixed length of each entry if fEntryOffset is null!
@@ -75,6 +99,8 @@ protected:
    Int_t       fLastWriteBufferSize[3] = {0,0,0}; ///<! Size of the buffer last three buffers we wrote it to disk
    bool        fResetAllocation{false};           ///<! True if last reset re-allocated the memory
    UChar_t     fNextBufferSizeRecord{0};          ///<! Index into fLastWriteBufferSize of the last buffer written to disk
+   std::vector<RZipBlock> fZipBlocks;             ///<! Blocks of the object, while some are not decompressed
+   std::vector<unsigned char> fZipData;           ///<! Compressed object, while some blocks are not decompressed
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t   fResetAllocationTime{0};           ///<! Time spent reallocating baskets in microseconds during last Reset operation.
 #endif
@@ -119,6 +145,16 @@ public:
    virtual void    DeleteEntryOffset();
    virtual Int_t   DropBuffers();
    TBranch        *GetBranch() const {return fBranch;}
+   // Hides the non-virtual TKey::GetBufferRef on purpose: the blocks that were not needed so far
+   // are decompressed first, see DecompressEntry. The TBasket member functions handing the buffer
+   // to the TKey machinery (Streamer, WriteBuffer, ...) decompress them too; only TBranch::GetEntry
+   // accesses a partially decompressed buffer.
+           TBuffer *GetBufferRef() const
+           {
+              if (R__unlikely(!fZipBlocks.empty()))
+                 const_cast<TBasket *>(this)->DecompressAllBlocks();
+              return fBufferRef;
+           }
            Int_t   GetBufferSize() const {return fBufferSize;}
            Int_t  *GetDisplacement() const {return fDisplacement;}
            Int_t *GetEntryOffset()
@@ -129,6 +165,8 @@ public:
            Int_t   GetNevBuf() const {return fNevBuf;}
            Int_t   GetNevBufSize() const {return fNevBufSize;}
            Int_t   GetLast() const {return fLast;}
+           bool    DecompressEntry(Int_t entry);
+           bool    IsPartiallyDecompressed() const { return !fZipBlocks.empty(); }
    virtual void    MoveEntries(Int_t dentries);
    virtual void    PrepareBasket(Long64_t /* entry */) {};
            Int_t   ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file);
@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -50,6 +52,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+class TBasketCompressor; ///< Compresses the full baskets in the background, see TTree::SetBackgroundCompression.
 }
 }
 
@@ -78,6 +81,11 @@ public:
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    /// Return true if the branch can be read through the bulk interfaces.
    bool SupportsBulkRead() const;
+   /// See TBranch::GetBulkCollectionEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
+   Int_t GetBulkCollectionEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
+   /// Return the type of the collection elements read by GetBulkCollectionEntries(), or kNoType_t if the branch
+   /// cannot be read through it.
+   EDataType GetBulkCollectionType() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -184,8 +192,11 @@ private:
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   virtual Int_t GetBulkCollectionEntries(Long64_t, TBuffer&, std::vector<Int_t>&) { return -1; }
+   virtual EDataType GetBulkCollectionType() { return kNoType_t; }
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   bool     WriteBasketInBackground(TBasket* basket, ROOT::Internal::TBasketCompressor *);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -321,6 +332,8 @@ inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) {
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
 inline bool   TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Int_t  TBulkBranchRead::GetBulkCollectionEntries(Long64_t evt, TBuffer& user_buf, std::vector<Int_t> &offsets) { return fParent.GetBulkCollectionEntries(evt, user_buf, offsets); }
+inline EDataType TBulkBranchRead::GetBulkCollectionType() const { return fParent.GetBulkCollectionType(); }
 
 }  // Internal
 }  // Experimental
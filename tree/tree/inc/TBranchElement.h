@@ -251,6 +251,8 @@ public:
 
 private:
    Int_t            FillImpl(ROOT::Internal::TBranchIMTHelper *) override;
+   Int_t            GetBulkCollectionEntries(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets) override;
+   EDataType        GetBulkCollectionType() override;
 
    ClassDefOverride(TBranchElement,10)  // Branch in case of an object
 };
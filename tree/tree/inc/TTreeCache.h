@@ -23,12 +23,19 @@
 
 #include "TFileCacheRead.h"
 
+#include <memory>
 #include <vector>
 
 class TTree;
 class TBranch;
 class TObjArray;
 
+namespace ROOT {
+namespace Internal {
+class TTreeCacheReadAhead;
+}
+}
+
 class TTreeCache : public TFileCacheRead {
 
 public:
@@ -104,6 +111,14 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   // Read-ahead of the clusters following the one in the cache, see SetReadAhead().
+   Int_t    fReadAheadClusters{0};   ///<! Number of clusters read in the background, 0 if disabled
+   Long64_t fReadAheadMaxBytes{-1};  ///<! Memory cap of the clusters read in the background, -1 for the default
+   std::unique_ptr<ROOT::Internal::TTreeCacheReadAhead> fReadAhead; ///<! Background reads, created on first use
+   Long64_t fReadAheadHits{0};       ///<! Number of baskets copied from the clusters read in the background
+
+   void ReadAhead();
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -124,6 +139,10 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    bool     ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   Int_t    TransferReadAhead(); ///< Fill the cache buffer from the clusters read ahead and from the file.
+   void     AccountReadAhead();  ///< Add the background reads to the statistics of the file.
+   void     ClearReadAhead();    ///< Wait for the background reads and release their buffers.
+
 public:
 
    TTreeCache();
@@ -146,6 +165,9 @@ public:
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
+   Int_t                GetReadAheadClusters() const { return fReadAheadClusters; }
+   Long64_t             GetReadAheadMaxBytes() const;
+   Long64_t             GetReadAheadHits() const { return fReadAheadHits; }
    TTree               *GetTree() const {return fTree;}
    bool                 IsAutoCreated() const {return fAutoCreated;}
    virtual bool         IsEnabled() const {return fEnabled;}
@@ -154,13 +176,16 @@ public:
    virtual bool         FillBuffer();
    Int_t                LearnBranch(TBranch *b, bool subgbranches = false) override;
    virtual void         LearnPrefill();
+   Int_t                LoadLearnedBranches(const char *filename);
 
    void                 Print(Option_t *option="") const override;
    Int_t                ReadBuffer(char *buf, Long64_t pos, Int_t len) override;
    virtual Int_t        ReadBufferNormal(char *buf, Long64_t pos, Int_t len);
+   Int_t                ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, Int_t &loc) override;
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveLearnedBranches(const char *filename) const;
    void                 SetAutoCreated(bool val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Long64_t buffersize) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
@@ -168,6 +193,7 @@ public:
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(bool opt);
+   void                 SetReadAhead(Int_t nclusters, Long64_t maxbytes = -1);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
@@ -26,6 +26,7 @@
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
 
+#include <algorithm>
 #include <bitset>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
@@ -174,6 +175,7 @@ Int_t TBasket::DropBuffers()
 {
    if (!fBuffer && !fBufferRef) return 0;
 
+   ResetZipBlocks();
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
    if (fBufferRef)    delete fBufferRef;
@@ -233,10 +235,130 @@ Int_t TBasket::GetEntryPointer(Int_t entry)
    Int_t *entryOffset = GetEntryOffset();
    if (entryOffset)  offset = entryOffset[entry];
    else              offset = fKeylen + entry*fNevBufSize;
-   fBufferRef->SetBufferOffset(offset);
+   GetBufferRef()->SetBufferOffset(offset);
    return offset;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Make sure that the bytes of the given entry of the basket are decompressed.
+///
+/// When a basket was written in several independently compressed blocks (see
+/// TTree::SetZipBlockSize), reading it only decompresses the blocks holding the
+/// entry offsets, if they are stored, and the other blocks are decompressed when
+/// an entry they hold is read. This way, the random access to a few entries
+/// (TEntryList, TTreeIndex) does not decompress the whole basket. Any other use
+/// of the buffer of the basket (GetBufferRef()) decompresses the remaining blocks.
+///
+/// Returns false if the blocks could not be decompressed.
+
+bool TBasket::DecompressEntry(Int_t entry)
+{
+   if (fZipBlocks.empty())
+      return true;
+   if (entry < 0 || entry >= fNevBuf || fDisplacement)
+      return DecompressRange(fKeylen, fKeylen + fObjlen);
+
+   Int_t *entryOffset = GetEntryOffset();
+   Int_t begin, end;
+   if (entryOffset) {
+      begin = entryOffset[entry];
+      end = entry + 1 < fNevBuf ? entryOffset[entry + 1] : fLast;
+   } else {
+      begin = fKeylen + entry * fNevBufSize;
+      end = begin + fNevBufSize;
+   }
+   return DecompressRange(begin, end);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set up the decompression on demand of an object compressed in several blocks.
+/// The compressed object starts at fKeylen in rawCompressedBuffer, which is only
+/// valid for the duration of the call: it is copied.
+///
+/// Returns false, leaving the whole decompression to the caller, if the object
+/// is made of a single block or if a header of a block is invalid.
+
+bool TBasket::InitializeZipBlocks(const char *rawCompressedBuffer)
+{
+   constexpr Int_t kZipBlockHeaderSize = 9; // See R__unzip_header
+   const Int_t nbytes = fNbytes - fKeylen;
+   auto *raw = reinterpret_cast<const unsigned char *>(rawCompressedBuffer) + fKeylen;
+   Int_t nin, nbuf;
+   Int_t in = 0, out = 0;
+   std::vector<RZipBlock> blocks;
+   while (out < fObjlen) {
+      if (in + kZipBlockHeaderSize > nbytes ||
+          R__unzip_header(&nin, const_cast<unsigned char *>(raw + in), &nbuf) != 0 ||
+          nin <= 0 || nbuf <= 0 || in + nin > nbytes) {
+         return false;
+      }
+      blocks.push_back(RZipBlock{in, nin, fKeylen + out, nbuf, false});
+      in += nin;
+      out += nbuf;
+   }
+   if (blocks.size() < 2 || out != fObjlen)
+      return false;
+
+   fZipData.assign(raw, raw + in);
+   fZipBlocks = std::move(blocks);
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decompress the blocks of the object overlapping the range [begin, end[ of
+/// fBufferRef that are not decompressed yet. The compressed object is released
+/// once all the blocks are decompressed.
+///
+/// Returns false in case of error.
+
+bool TBasket::DecompressRange(Int_t begin, Int_t end)
+{
+   // Optional monitor for zip time profiling.
+   Double_t start = 0;
+   if (R__unlikely(gPerfStats)) {
+      start = TTimeStamp();
+   }
+
+   Int_t nintot = 0, noutot = 0;
+   for (auto &block : fZipBlocks) {
+      if (block.fDone || block.fOut + block.fNout <= begin || block.fOut >= end)
+         continue;
+      Int_t nin = block.fNin;
+      Int_t nbuf = block.fNout;
+      Int_t nout = 0;
+      R__unzip(&nin, fZipData.data() + block.fIn, &nbuf,
+               reinterpret_cast<unsigned char *>(fBufferRef->Buffer()) + block.fOut, &nout);
+      if (R__unlikely(nout != block.fNout)) {
+         Error("DecompressRange", "fNbytes = %d, fKeylen = %d, fObjlen = %d, block at %d: nout=%d, nbuf=%d", fNbytes,
+               fKeylen, fObjlen, block.fOut, nout, block.fNout);
+         return false;
+      }
+      block.fDone = true;
+      nintot += block.fNin;
+      noutot += block.fNout;
+   }
+
+   if (noutot) {
+      TVirtualPerfStats* temp = gPerfStats;
+      if (fBranch->GetTree()->GetPerfStats() != nullptr) gPerfStats = fBranch->GetTree()->GetPerfStats();
+      if (R__unlikely(gPerfStats)) {
+         gPerfStats->UnzipEvent(fBranch->GetTree(), fSeekKey, start, nintot, noutot);
+      }
+      gPerfStats = temp;
+   }
+
+   if (std::all_of(fZipBlocks.begin(), fZipBlocks.end(), [](const RZipBlock &block) { return block.fDone; }))
+      ResetZipBlocks();
+   return true;
+}
+
+void TBasket::ResetZipBlocks()
+{
+   fZipBlocks.clear();
+   fZipData.clear();
+   fZipData.shrink_to_fit();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Load basket buffers in memory without unziping.
 /// This function is called by TTreeCloner.
@@ -312,6 +434,7 @@ void TBasket::MoveEntries(Int_t dentries)
    Int_t i;
 
    if (dentries >= fNevBuf) return;
+   DecompressAllBlocks();
    Int_t bufbegin;
    Int_t moved;
 
@@ -438,6 +561,18 @@ void inline TBasket::InitializeCompressedBuffer(Int_t len, TFile* file)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Stop using the compressed buffer shared with the other baskets of the branch (or
+/// of the tree): the next compression allocates a buffer owned by this basket.
+/// Needed when the basket is compressed on another thread, see TTree::SetBackgroundCompression.
+
+void TBasket::DetachCompressedBuffer()
+{
+   if (fOwnsCompressedBuffer)
+      return;
+   fCompressedBufferRef = nullptr;
+}
+
 void TBasket::ResetEntryOffset()
 {
    if (fEntryOffset != reinterpret_cast<Int_t *>(-1)) {
@@ -471,6 +606,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
 
+   ResetZipBlocks();
+
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
    {
@@ -600,6 +737,13 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
 
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, fKeylen);
+
+      // An object compressed in several blocks is decompressed on demand, see DecompressEntry.
+      if (!oldCase && InitializeZipBlocks(rawCompressedBuffer)) {
+         len = fObjlen+fKeylen;
+         goto AfterBuffer;
+      }
+
       char *rawUncompressedObjectBuffer = rawUncompressedBuffer+fKeylen;
       UChar_t *rawCompressedObjectBuffer = (UChar_t*)rawCompressedBuffer+fKeylen;
       Int_t nin, nbuf;
@@ -656,6 +800,9 @@ AfterBuffer:
       return 0;
    }
    // At this point, we're required to read out an offset array.
+   if (R__unlikely(!fZipBlocks.empty()) && !DecompressRange(fLast, fKeylen + fObjlen)) {
+      return 1;
+   }
    ResetEntryOffset(); // TODO: every basket, we reset the offset array.  Is this necessary?
                        // Could we instead switch to std::vector?
    fBufferRef->SetBufferOffset(fLast);
@@ -712,6 +859,7 @@ Int_t TBasket::ReadBasketBytes(Long64_t pos, TFile *file)
 /// This TBasket is now useless and invalid until it is told to adopt a buffer.
 void TBasket::DisownBuffer()
 {
+   ResetZipBlocks();
    fBufferRef = nullptr;
 }
 
@@ -933,6 +1081,7 @@ void TBasket::SetReadMode()
 
 void TBasket::SetWriteMode()
 {
+   DecompressAllBlocks();
    fBufferRef->SetWriteMode();
    fBufferRef->SetBufferOffset(fLast);
 }
@@ -1027,6 +1176,7 @@ void TBasket::Streamer(TBuffer &b)
       }
    } else {
 
+      DecompressAllBlocks();
       TKey::Streamer(b);   //this must be first
       b.WriteVersion(TBasket::IsA());
       if (fBufferRef) {
@@ -1132,6 +1282,8 @@ Int_t TBasket::WriteBuffer()
 {
    constexpr Int_t kWrite = 1;
 
+   DecompressAllBlocks();
+
    TFile *file = fBranch->GetFile(kWrite);
    if (!file) return 0;
    if (!file->IsWritable()) {
@@ -1170,7 +1322,30 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
-   // Transfer fEntryOffset table at the end of fBuffer.
+   PrepareBufferForWrite();
+
+   // Note that we allow multiple TBasket compressions to occur at once
+   // for a given TFile: that's because the compression buffer when we use IMT is no longer
+   // shared amongst several threads.
+#ifdef R__USE_IMT
+   sentry.unlock();
+#endif  // R__USE_IMT
+   Int_t nzip = CompressBuffer(file);
+#ifdef R__USE_IMT
+   sentry.lock();
+#endif  // R__USE_IMT
+   if (nzip < 0)
+      return -1;
+
+   return WriteCompressedBuffer(nzip, fBranch->GetWriteBasket(), file);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the fEntryOffset table at the end of fBuffer and set the size of the object,
+/// the first stage of WriteBuffer.
+
+void TBasket::PrepareBufferForWrite()
+{
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
    if (entryOffset) {
@@ -1204,74 +1379,86 @@ Int_t TBasket::WriteBuffer()
       }
    }
 
-   Int_t nout, noutot, bufmax, nzip;
-
    fObjlen = fBufferRef->Length() - fKeylen;
+}
 
-   fHeaderOnly = true;
-   fCycle = fBranch->GetWriteBasket();
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the object part of the buffer into the compressed buffer, the second stage
+/// of WriteBuffer. It does not use the file, except to set it as parent of the buffer,
+/// and can therefore run on another thread than the one writing to the file.
+///
+/// Returns the compressed size, 0 if the buffer is to be written uncompressed
+/// (no compression or compression not worth it) or -1 on error.
+
+Int_t TBasket::CompressBuffer(TFile *file)
+{
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
-   ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(fBranch->GetCompressionAlgorithm());
+   Int_t cxAlgorithm = fBranch->GetCompressionAlgorithm();
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
-      cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
-   if (cxlevel > 0) {
-      Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
-      Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
-      InitializeCompressedBuffer(buflen, file);
-      if (!fCompressedBufferRef) {
-         Warning("WriteBuffer", "Unable to allocate the compressed buffer");
-         return -1;
-      }
-      fCompressedBufferRef->SetWriteMode();
-      fBuffer = fCompressedBufferRef->Buffer();
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
-         // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
-         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-#ifdef R__USE_IMT
-         sentry.lock();
-#endif  // R__USE_IMT
+      cxAlgorithm = file->GetCompressionAlgorithm();
 
-         // test if buffer has really been compressed. In case of small buffers
-         // when the buffer contains random data, it may happen that the compressed
-         // buffer is larger than the input. In this case, we write the original uncompressed buffer
-         if (nout == 0 || nout >= fObjlen) {
-            nout = fObjlen;
-            // We used to delete fBuffer here, we no longer want to since
-            // the buffer (held by fCompressedBufferRef) might be re-used later.
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
-            if ((nout+fKeylen)>buflen) {
-               Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
-                  (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
-            }
-            goto WriteFile;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
-      }
-      nout = noutot;
-      Create(noutot,file);
+   if (cxlevel <= 0)
+      return 0;
+
+   // The blocks are compressed independently, see TTree::SetZipBlockSize.
+   Int_t blockSize = fBranch->GetTree() ? fBranch->GetTree()->GetZipBlockSize() : 0;
+   if (blockSize <= 0 || blockSize > kMAXZIPBUF)
+      blockSize = kMAXZIPBUF;
+
+   Int_t nout, noutot, bufmax, nzip;
+   Int_t nbuffers = 1 + (fObjlen - 1) / blockSize;
+   Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
+   InitializeCompressedBuffer(buflen, file);
+   if (!fCompressedBufferRef) {
+      Warning("WriteBuffer", "Unable to allocate the compressed buffer");
+      return -1;
+   }
+   fCompressedBufferRef->SetWriteMode();
+   char *objbuf = fBufferRef->Buffer() + fKeylen;
+   char *bufcur = fCompressedBufferRef->Buffer() + fKeylen;
+   noutot = 0;
+   nzip   = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      if (i == nbuffers - 1) bufmax = fObjlen - nzip;
+      else bufmax = blockSize;
+      // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
+      // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
+      // (see fCompressedBufferRef in constructor).
+      R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout,
+                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(cxAlgorithm));
+
+      // test if buffer has really been compressed. In case of small buffers
+      // when the buffer contains random data, it may happen that the compressed
+      // buffer is larger than the input. In this case, we write the original uncompressed buffer
+      if (nout == 0 || nout >= fObjlen)
+         return 0;
+      bufcur += nout;
+      noutot += nout;
+      objbuf += blockSize;
+      nzip   += blockSize;
+   }
+   return noutot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the key and the buffer to the file, the last stage of WriteBuffer.
+/// nzip is the result of CompressBuffer: the buffer is written uncompressed if it is 0.
+///
+/// Returns the number of bytes committed to the memory or -1 on error.
+
+Int_t TBasket::WriteCompressedBuffer(Int_t nzip, Int_t cycle, TFile *file)
+{
+   Int_t nout;
+   fHeaderOnly = true;
+   fCycle = cycle;
+   if (nzip > 0) {
+      // We used to delete fBuffer when writing uncompressed, we no longer want to since
+      // the buffer (held by fCompressedBufferRef) might be re-used later.
+      fBuffer = fCompressedBufferRef->Buffer();
+      nout = nzip;
+      Create(nzip,file);
       fBufferRef->SetBufferOffset(0);
 
       Streamer(*fBufferRef);         //write key itself again
@@ -1285,8 +1472,29 @@ Int_t TBasket::WriteBuffer()
       nout = fObjlen;
    }
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = false;
    return nBytes>0 ? fKeylen+nout : -1;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write a basket prepared by PrepareBufferForWrite and compressed by CompressBuffer,
+/// possibly on another thread, to the current file of the branch.
+/// cycle is the number of the basket in its branch.
+///
+/// Returns the number of bytes committed to the memory or -1 on error.
+
+Int_t TBasket::FinishWriteBuffer(Int_t nzip, Int_t cycle)
+{
+   constexpr Int_t kWrite = 1;
+
+   TFile *file = fBranch->GetFile(kWrite);
+   if (!file || !file->IsWritable() || nzip < 0)
+      return -1;
+   fMotherDir = file;
+
+#ifdef R__USE_IMT
+   std::lock_guard<std::mutex> sentry(file->fWriteMutex);
+#endif  // R__USE_IMT
+   return WriteCompressedBuffer(nzip, cycle, file);
+}
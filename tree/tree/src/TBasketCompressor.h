@@ -0,0 +1,127 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TBasketCompressor
+#define ROOT_TBasketCompressor
+
+#include "RtypesCore.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TBranch;
+
+/** \class ROOT::Internal::TBasketCompressor
+ Compresses the full baskets of a TTree on IMT tasks while the tree keeps being filled,
+ see TTree::SetBackgroundCompression().
+
+ Each branch has at most one basket being compressed, in addition to the basket being filled. When the next
+ basket of the branch is full, the previous one is finished (waiting for its compression if needed), written to
+ the file and reused as the basket being filled: the memory used is bounded by two baskets per branch. The
+ compressed baskets are written to the file by the filling thread, since TFile is not thread-safe; the tasks only
+ touch the basket they compress, which has its own compressed buffer instead of the transient buffer of the branch.
+*/
+
+namespace ROOT {
+namespace Internal {
+
+class TBasketCompressor {
+public:
+   /// Run on a task, returns the compressed size (or a negative value on error)
+   using Compress_t = std::function<Int_t()>;
+   /// Run by the filling thread with the result of the compression, to write the basket or to drop it
+   using Finish_t = std::function<void(Int_t nzip, bool write)>;
+
+private:
+   struct RJob {
+      Compress_t fCompress;
+      Finish_t fFinish;
+      Int_t fResult{0};
+      ULong64_t fSequence{0}; ///< Order of submission, to write the baskets in a reproducible order
+#ifdef R__USE_IMT
+      std::unique_ptr<ROOT::Experimental::TTaskGroup> fTask;
+#endif
+   };
+
+   std::unordered_map<const TBranch *, std::unique_ptr<RJob>> fJobs; ///< The basket being compressed, per branch
+   ULong64_t fNSubmitted{0};                                         ///< Number of jobs submitted so far
+
+   void Finish(std::unique_ptr<RJob> job, bool write)
+   {
+#ifdef R__USE_IMT
+      job->fTask->Wait();
+#endif
+      job->fFinish(job->fResult, write);
+   }
+
+public:
+   TBasketCompressor() = default;
+   TBasketCompressor(const TBasketCompressor &) = delete;
+   TBasketCompressor &operator=(const TBasketCompressor &) = delete;
+   ~TBasketCompressor() { FinishAll(false); }
+
+   bool IsEmpty() const { return fJobs.empty(); }
+
+   /// Start compressing a basket of the branch. The previous basket of the branch must have been finished.
+   void Submit(const TBranch *branch, Compress_t &&compress, Finish_t &&finish)
+   {
+      auto job = std::make_unique<RJob>();
+      job->fCompress = std::move(compress);
+      job->fFinish = std::move(finish);
+      job->fSequence = fNSubmitted++;
+      auto *j = job.get();
+#ifdef R__USE_IMT
+      job->fTask = std::make_unique<ROOT::Experimental::TTaskGroup>();
+      fJobs[branch] = std::move(job);
+      j->fTask->Run([j]() { j->fResult = j->fCompress(); });
+#else
+      j->fResult = j->fCompress();
+      fJobs[branch] = std::move(job);
+#endif
+   }
+
+   /// Wait for the basket of the branch being compressed, if any, and write it.
+   void Finish(const TBranch *branch)
+   {
+      auto it = fJobs.find(branch);
+      if (it == fJobs.end())
+         return;
+      auto job = std::move(it->second);
+      fJobs.erase(it);
+      Finish(std::move(job), true);
+   }
+
+   /// Wait for all the compressions, and write the baskets or drop them.
+   void FinishAll(bool write)
+   {
+      std::vector<std::unique_ptr<RJob>> jobs;
+      for (auto &job : fJobs)
+         jobs.emplace_back(std::move(job.second));
+      fJobs.clear();
+      std::sort(jobs.begin(), jobs.end(), [](const std::unique_ptr<RJob> &a, const std::unique_ptr<RJob> &b) {
+         return a->fSequence < b->fSequence;
+      });
+      for (auto &job : jobs)
+         Finish(std::move(job), write);
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -50,6 +50,7 @@
 #include "snprintf.h"
 
 #include "TBranchIMTHelper.h"
+#include "TBasketCompressor.h"
 
 #include "ROOT/TIOFeatures.hxx"
 
@@ -1237,6 +1238,10 @@ TBasket* TBranch::GetBasketImpl(Int_t basketnumber, TBuffer *user_buffer)
    if (basket) return basket;
    if (basketnumber == fWriteBasket) return nullptr;
 
+   // The basket might still be compressed in the background
+   if (fTree->GetBackgroundCompression() && fBasketSeek[basketnumber] == 0)
+      fTree->FinishBackgroundCompression();
+
    // create/decode basket parameters from buffer
    TFile *file = GetFile(0);
    if (file == nullptr) {
@@ -1717,7 +1722,8 @@ Int_t TBranch::GetEntry(Long64_t entry, Int_t getall)
    if (R__unlikely(result < 0)) { return result + 1; }
 
    basket->PrepareBasket(entry);
-   TBuffer* buf = basket->GetBufferRef();
+   // Not GetBufferRef(), which would decompress the whole basket; see TBasket::DecompressEntry.
+   TBuffer* buf = basket->fBufferRef;
 
    // This test necessary to read very old Root files (NvE).
    if (R__unlikely(!buf)) {
@@ -1734,6 +1740,9 @@ Int_t TBranch::GetEntry(Long64_t entry, Int_t getall)
    if (R__unlikely(!buf->IsReading())) {
       basket->SetReadMode();
    }
+   if (R__unlikely(basket->IsPartiallyDecompressed()) && !basket->DecompressEntry(entry - first)) {
+      return -1;
+   }
 
    Int_t* entryOffset = basket->GetEntryOffset();
    Int_t bufbegin = 0;
@@ -1798,7 +1807,10 @@ Int_t TBranch::GetEntryExport(Long64_t entry, Int_t /*getall*/, TClonesArray* li
       fNextBasketEntry = -1;
       return 0;
    }
-   TBuffer* buf = basket->GetBufferRef();
+   TBuffer* buf = basket->fBufferRef;
+   if (R__unlikely(basket->IsPartiallyDecompressed()) && !basket->DecompressEntry(entry - first)) {
+      return -1;
+   }
    // Set entry offset in buffer and read data from all leaves.
    if (!TestBit(kDoNotUseBufferMap)) {
       buf->ResetMap();
@@ -3210,6 +3222,12 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+   if (imtHelper && imtHelper->GetCompressor() && where == fWriteBasket && basket->IsA() == TBasket::Class() &&
+       !basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed) &&
+       WriteBasketInBackground(basket, imtHelper->GetCompressor())) {
+      return 0;
+   }
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -3273,6 +3291,81 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the full basket being filled to the background compressor and continue the
+/// filling in a new basket, see TTree::SetBackgroundCompression.
+///
+/// The previous basket of this branch, if still in the compressor, is first written
+/// to the file and becomes the basket being filled.
+///
+/// Returns false, without doing anything, if the basket cannot be written.
+
+bool TBranch::WriteBasketInBackground(TBasket *basket, ROOT::Internal::TBasketCompressor *compressor)
+{
+   const Int_t where = fWriteBasket;
+   TFile *file = GetFile(1);
+   if (!file || !file->IsWritable())
+      return false;
+   basket->PrepareBufferForWrite();
+
+   // The basket leaves the branch until it is written
+   fBaskets[where] = nullptr;
+   --fNBaskets;
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = nullptr;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+
+   // One basket of the branch at a time in the compressor: this bounds the memory used,
+   // and the previous basket, once written, is reused for the next entries.
+   compressor->Finish(this);
+
+   // The transient buffer of the branch is used by the filling and the reading of the
+   // other baskets while this one is compressed; compress into a buffer of its own.
+   basket->DetachCompressedBuffer();
+
+   auto compress = [basket, file]() { return basket->CompressBuffer(file); };
+   auto finish = [this, basket, where](Int_t nzip, bool write) {
+      Int_t nout = write ? basket->FinishWriteBuffer(nzip, where) : 0;
+      if (nout < 0)
+         Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+      if (nout <= 0) {
+         basket->DropBuffers();
+         delete basket;
+         return;
+      }
+      fBasketBytes[where] = basket->GetNbytes();
+      fBasketSeek[where]  = basket->GetSeekKey();
+      Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+      basket->WriteReset();
+
+      fZipBytes += nout;
+      fTotBytes += addbytes;
+      fTree->AddTotBytes(addbytes);
+      fTree->AddZipBytes(nout);
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+      fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+      fTree->AddAllocationCount(basket->GetResetAllocationCount());
+
+      // Reuse the basket for the next entries, unless the branch already has one.
+      if (!fBaskets.At(fWriteBasket)) {
+         fBaskets.AddAtAndExpand(basket, fWriteBasket);
+         ++fNBaskets;
+      } else {
+         delete basket;
+      }
+   };
+   compressor->Submit(this, compress, finish);
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
@@ -2833,6 +2833,138 @@ Int_t TBranchElement::GetExpectedType(TClass *&expectedClass,EDataType &expected
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the type of the elements of the collection held by this branch if it
+/// can be read with GetBulkCollectionEntries(), kNoType_t otherwise.
+///
+/// This is the case of a non-split std::vector of a fixed-size numerical type,
+/// either as a top-level branch or as a data member of a split object.  Its
+/// entries are streamed as a byte count and a version, followed by the number
+/// of elements and the elements themselves.
+
+EDataType TBranchElement::GetBulkCollectionType()
+{
+   if (fType != kLeafNode || fBranchCount || fBranchCount2)
+      return kNoType_t;
+   if (fStreamerType != -1 && fStreamerType != TVirtualStreamerInfo::kSTL)
+      return kNoType_t;
+
+   TClass *expectedClass = nullptr;
+   EDataType expectedType = kOther_t;
+   if (GetExpectedType(expectedClass, expectedType) || !expectedClass)
+      return kNoType_t;
+   TVirtualCollectionProxy *proxy = expectedClass->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() || proxy->HasPointers())
+      return kNoType_t;
+
+   switch (proxy->GetType()) {
+   case kChar_t:
+   case kUChar_t:
+   case kShort_t:
+   case kUShort_t:
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t:
+   case kDouble_t:
+   case kLong64_t:
+   case kULong64_t: return proxy->GetType();
+   default: return kNoType_t;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read the collections of the entries of a basket into contiguous memory.
+///
+/// \return On success, the number of entries read, from `entry` to the last
+///         entry of its basket.  -1 on failure, in which case the entries can
+///         still be read with GetEntry().
+///
+/// The elements of the collections are deserialized (byte swapped) one after
+/// the other into `user_buf`, starting at its current position.  The elements
+/// of the `i`-th entry read are the ones between `offsets[i]` and
+/// `offsets[i+1]`, so that `offsets` holds one more value than the number of
+/// entries read:
+///
+/// ~~~{.cpp}
+/// auto values = reinterpret_cast<float *>(user_buf.GetCurrent());
+/// for (Int_t i = offsets[entryIndex]; i < offsets[entryIndex + 1]; ++i)
+///    sum += values[i];
+/// ~~~
+///
+/// Unlike GetEntry(), the entries are not streamed into the branch address one
+/// by one: the entry offsets of the basket are used to locate the elements of
+/// each entry, which are copied in a single pass.  The branch must hold a
+/// collection supported by GetBulkCollectionType().
+///
+/// \note This interface is not meant to be exposed to end users, but rather it
+///       should be wrapped by higher-level interfaces such as TTreeReaderArray.
+
+Int_t TBranchElement::GetBulkCollectionEntries(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   const EDataType type = GetBulkCollectionType();
+   if (R__unlikely(type == kNoType_t || TestBit(kDoNotProcess)))
+      return -1;
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   TBasket *basket = nullptr;
+   Long64_t first;
+   if (R__unlikely(GetBasketAndFirst(basket, first, nullptr) < 0))
+      return -1;
+
+   basket->PrepareBasket(entry);
+   TBuffer *buf = basket->GetBufferRef();
+   // Very old ROOT files and baskets with displacements go through GetEntry().
+   if (R__unlikely(!buf || basket->GetDisplacement()))
+      return -1;
+   if (R__unlikely(!buf->IsReading()))
+      basket->SetReadMode();
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset))
+      return -1;
+
+   const Int_t firstIndex = entry - first;
+   const Int_t nEntries = basket->GetNevBuf() - firstIndex;
+   const Int_t elementSize = TDataType::GetDataType(type)->Size();
+   // The elements take less room than the serialized entries they come from.
+   const Int_t bufbegin = user_buf.Length();
+   user_buf.AutoExpand(bufbegin + basket->GetLast() - entryOffset[firstIndex]);
+
+   const UInt_t kByteCountMask = 0x40000000; // OR the byte count with this
+   char *input = buf->Buffer();
+   char *output = user_buf.Buffer() + bufbegin;
+   offsets.resize(nEntries + 1);
+   offsets[0] = 0;
+   for (Int_t i = 0; i < nEntries; ++i) {
+      const Int_t index = firstIndex + i;
+      const Int_t begin = entryOffset[index];
+      const Int_t end = (index + 1 < basket->GetNevBuf()) ? entryOffset[index + 1] : basket->GetLast();
+      char *cursor = input + begin;
+      UInt_t byteCount;
+      Version_t version;
+      Int_t nElements;
+      if (R__unlikely(end - begin < Int_t(sizeof(byteCount) + sizeof(version) + sizeof(nElements))))
+         return -1;
+      frombuf(cursor, &byteCount);
+      frombuf(cursor, &version);
+      frombuf(cursor, &nElements);
+      // Entries that do not hold exactly the byte count, the version, the size and the elements are left to GetEntry().
+      const Long64_t nBytes = Long64_t(nElements) * elementSize;
+      if (R__unlikely(!(byteCount & kByteCountMask) || version <= 0 || (version & TBufferFile::kStreamedMemberWise) ||
+                      nElements < 0 || (byteCount & ~kByteCountMask) != sizeof(version) + sizeof(nElements) + nBytes ||
+                      cursor + nBytes != input + end))
+         return -1;
+      memcpy(output + Long64_t(offsets[i]) * elementSize, cursor, nBytes);
+      offsets[i + 1] = offsets[i] + nElements;
+   }
+
+   user_buf.SetBufferOffset(bufbegin);
+   if (elementSize > 1)
+      user_buf.ByteSwapBuffer(offsets[nEntries], type);
+   return nEntries;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the 'full' name of the branch.  In particular prefix  the mother's name
 /// when it does not end in a trailing dot and thus is not part of the branch name
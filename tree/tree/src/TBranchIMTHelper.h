@@ -25,6 +25,8 @@
 namespace ROOT {
 namespace Internal {
 
+class TBasketCompressor;
+
 class TBranchIMTHelper {
 
 #ifdef R__USE_IMT
@@ -57,9 +59,14 @@ public:
    Long64_t GetNbytes() { return fBytes; }
    Long64_t GetNerrors() {  return fNerrors; }
 
+   /// Compressor of the full baskets, set when the tree compresses them in the background
+   void SetCompressor(TBasketCompressor *compressor) { fCompressor = compressor; }
+   TBasketCompressor *GetCompressor() const { return fCompressor; }
+
 private:
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
+   TBasketCompressor    *fCompressor{nullptr}; ///< Not owned, see TTree::SetBackgroundCompression
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
@@ -230,6 +230,9 @@ A TTree instance is filled with the invocation of the TTree::Fill method:
 Upon its invocation, a loop on all defined branches takes place that for each branch invokes
 the TBranch::Fill method.
 
+When implicit multi-threading is enabled, the full baskets can be compressed in the background
+while the tree keeps being filled, see TTree::SetBackgroundCompression.
+
 \anchor addcoltoexistingtree
 ## Add a column to an already existing Tree
 
@@ -430,6 +433,7 @@ End_Macro
 #include "snprintf.h"
 
 #include "TBranchIMTHelper.h"
+#include "TBasketCompressor.h"
 #include "TNotifyLink.h"
 
 #include <chrono>
@@ -920,6 +924,8 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   // The baskets still being compressed are not written, as for the baskets being filled.
+   FinishBackgroundCompression(false);
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -4623,6 +4629,7 @@ Int_t TTree::Fill()
       fIMTFlush = true;
       fIMTZipBytes.store(0);
       fIMTTotBytes.store(0);
+      imtHelper.SetCompressor(fBasketCompressor.get());
    }
 #endif
 
@@ -5147,6 +5154,7 @@ Int_t TTree::FlushBaskets(bool create_cluster) const
 Int_t TTree::FlushBasketsImpl() const
 {
    if (!fDirectory) return 0;
+   FinishBackgroundCompression();
    Int_t nbytes = 0;
    Int_t nerror = 0;
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
@@ -8003,6 +8011,7 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+   FinishBackgroundCompression(false);
    fNotify        = nullptr;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -8034,6 +8043,7 @@ void TTree::Reset(Option_t* option)
 
 void TTree::ResetAfterMerge(TFileMergeInfo *info)
 {
+   FinishBackgroundCompression(false);
    fEntries       = 0;
    fNClusterRange = 0;
    fTotBytes      = 0;
@@ -8345,6 +8355,56 @@ void TTree::SetAutoSave(Long64_t autos)
    fAutoSave = autos;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the full baskets in the background while the tree is filled.
+///
+/// By default, TTree::Fill compresses and writes a basket as soon as it is full, which
+/// blocks the caller for the duration of the compression. When background compression is
+/// enabled, the full baskets are instead compressed on implicit multi-threading tasks while
+/// the next entries are filled. The file is only ever written by the thread calling TTree::Fill.
+///
+/// Each branch has at most one basket being compressed in addition to the basket being
+/// filled: when the next basket of the branch is full, TTree::Fill waits for the compression
+/// of the previous one if needed, writes it and reuses it for the next entries. The memory
+/// used is therefore at most twice the size of the baskets, plus the compressed buffers of
+/// these baskets (they cannot use the transient buffer of the branch, see TBranch::GetTransientBuffer).
+///
+/// The baskets still being compressed are written by TTree::FlushBaskets, and hence by
+/// TTree::Write and TTree::AutoSave, or explicitly by TTree::FinishBackgroundCompression.
+///
+/// Background compression requires implicit multi-threading (ROOT::EnableImplicitMT) to
+/// be enabled both globally and for this tree (TTree::SetImplicitMT); otherwise the
+/// baskets are compressed when they are full, as usual.
+
+void TTree::SetBackgroundCompression(bool enable)
+{
+#ifdef R__USE_IMT
+   if (enable) {
+      if (!fBasketCompressor)
+         fBasketCompressor = std::make_unique<ROOT::Internal::TBasketCompressor>();
+      if (!ROOT::IsImplicitMTEnabled() || !fIMTEnabled)
+         Warning("SetBackgroundCompression", "implicit multi-threading is disabled for %s", GetName());
+      return;
+   }
+   FinishBackgroundCompression();
+   fBasketCompressor.reset();
+#else
+   if (enable)
+      Warning("SetBackgroundCompression", "ROOT was built without implicit multi-threading support, ignoring it");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the baskets being compressed in the background, see TTree::SetBackgroundCompression.
+///
+/// The baskets are written to the file if write is true and dropped otherwise.
+
+void TTree::FinishBackgroundCompression(bool write) const
+{
+   if (fBasketCompressor)
+      fBasketCompressor->FinishAll(write);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a branch's basket size.
 ///
@@ -9377,6 +9437,30 @@ void TTree::SetWeight(Double_t w, Option_t*)
    fWeight = w;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets written from now on in independently decompressible blocks
+/// of at most size bytes of uncompressed data; 0 restores the default, a single
+/// block per basket (up to 16 MB).
+///
+/// A basket made of several blocks is decompressed on demand when it is read: only
+/// the blocks holding the entry offsets (if they are stored in the basket, see
+/// ROOT::Experimental::EIOFeatures::kGenerateOffsetMap) and the blocks holding the
+/// entries actually read are decompressed. Random access to a few entries of the
+/// tree, for instance through a TEntryList or a TTreeIndex, then does not need to
+/// decompress the whole baskets. Smaller blocks compress less well; a block size of
+/// a few tens of kilobytes is a reasonable compromise for large baskets.
+///
+/// The baskets written in blocks can be read by any version of ROOT.
+
+void TTree::SetZipBlockSize(Int_t size)
+{
+   if (size < 0) {
+      Error("SetZipBlockSize", "the block size must be positive, got %d", size);
+      return;
+   }
+   fZipBlockSize = size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print values of all active leaves for entry.
 ///
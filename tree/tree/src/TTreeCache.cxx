@@ -20,6 +20,7 @@
 - [General Description](\ref description)
 - [Changes in behaviour](\ref changesbehaviour)
 - [Self-optimization](\ref cachemisses)
+- [Read-ahead](\ref readahead)
 - [Examples of usage](\ref examples)
 - [Check performance and stats](\ref checkPerf)
 
@@ -62,6 +63,16 @@ the branches being processed via direct manipulation of TTrees or with tools
 such as TTree::Draw, TTree::Process, TSelector, TTreeReader and RDataFrame
 when in the learning phase. The learning phase is by default 100 entries.
 It can be changed via TTreeCache::SetLearnEntries.
+The branches learned by a job can be saved with TTreeCache::SaveLearnedBranches
+and given to the cache of a later job with TTreeCache::LoadLearnedBranches: the
+learning phase is then skipped and the first cluster is read with all these branches.
+~~~ {.cpp}
+    // at the end of a first job
+    tree->GetReadCache(file)->SaveLearnedBranches("analysis.branches");
+    // in the next jobs, before the event loop
+    tree->SetCacheSize(30000000);
+    tree->GetReadCache(file)->LoadLearnedBranches("analysis.branches");
+~~~
 
 The usage of a TTreeCache can considerably improve the runtime performance at
 the price of a modest investment in memory, in particular when the TTree is
@@ -129,6 +140,27 @@ Additionally, on the first miss of an event, we must iterate through all the
 This can be potentially a CPU-expensive operation compared to, e.g., the
 latency of a SSD.  This is why the miss cache is currently disabled by default.
 
+\anchor readahead
+## Reading the next clusters in the background
+
+By default the baskets of a cluster are read when the cache is filled for the
+first entry of the cluster, and the processing of the cluster waits for the read.
+With SetReadAhead(n), each time the cache is filled the baskets of the n
+following clusters are read in the background, while the current cluster is
+processed (and, with TTreeCacheUnzip, decompressed on IMT tasks). When the cache
+is then filled for one of these clusters, the baskets are taken from memory.
+~~~ {.cpp}
+    tree->SetCacheSize(32000000);
+    tree->GetReadCache(file)->SetReadAhead(2);
+~~~
+The background reads are done by one I/O thread per cache, through a second
+handle on the file, which is supported for local files and for files read with
+Davix or XRootD; for other files the option has no effect. The memory used by
+the clusters read ahead is capped by the second argument of SetReadAhead, by
+default 2*n times the size of the cache. The default number of clusters can be
+set with the `TTreeCache.ReadAhead` resource or the `ROOT_TTREECACHE_READAHEAD`
+environment variable.
+
 \anchor examples
 ## Example usages of TTreeCache
 
@@ -299,7 +331,10 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "TTreeCacheReadAhead.h"
+#include <algorithm>
 #include <climits>
+#include <fstream>
 
 #include <memory>
 
@@ -307,10 +342,22 @@ Int_t TTreeCache::fgLearnEntries = 100;
 
 ClassImp(TTreeCache);
 
+namespace {
+/// Number of clusters to read ahead from the environment or resource variable, 0 by default.
+Int_t GetConfiguredReadAhead()
+{
+   const char *stcp = gSystem->Getenv("ROOT_TTREECACHE_READAHEAD");
+   if (!stcp || !*stcp)
+      return gEnv->GetValue("TTreeCache.ReadAhead", 0);
+   return TString(stcp).Atoi();
+}
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
-TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType())
+TTreeCache::TTreeCache()
+   : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType()), fReadAheadClusters(GetConfiguredReadAhead())
 {
 }
 
@@ -319,7 +366,8 @@ TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillTy
 
 TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    : TFileCacheRead(tree->GetCurrentFile(), buffersize, tree), fEntryMax(tree->GetEntriesFast()), fEntryNext(0),
-     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType())
+     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType()),
+     fReadAheadClusters(GetConfiguredReadAhead())
 {
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
@@ -333,6 +381,7 @@ TTreeCache::~TTreeCache()
 {
    // Informe the TFile that we have been deleted (in case
    // we are deleted explicitly by legacy user code).
+   ClearReadAhead();
    if (fFile) fFile->SetCacheRead(nullptr, fTree);
 
    delete fBranches;
@@ -1791,6 +1840,7 @@ bool TTreeCache::FillBuffer()
       }
    }
    fIsLearning = false;
+   ReadAhead();
    return true;
 }
 
@@ -1978,6 +2028,160 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the content of the cache from the file when the first block is requested.
+/// When clusters are read ahead, the baskets already read in the background are copied
+/// and only the other ones are read from the file.
+
+Int_t TTreeCache::ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, Int_t &loc)
+{
+   if (fReadAhead && fNseek > 0 && !fIsSorted && !fAsyncReading) {
+      Sort();
+      loc = -1;
+      if (TransferReadAhead())
+         return -1;
+      fIsTransferred = kTRUE;
+   }
+   return TFileCacheRead::ReadBufferExtNormal(buf, pos, len, loc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the sorted blocks of the cache buffer, from the clusters read ahead when possible.
+/// The remaining blocks are read from the file with a single vector read.
+/// Returns 0 on success, as TFile::ReadBuffers.
+
+Int_t TTreeCache::TransferReadAhead()
+{
+   std::vector<Int_t> missing;
+   for (Int_t i = 0; i < fNseek; ++i) {
+      if (fReadAhead->Fetch(fBuffer + fSeekPos[i], fSeekSort[i], fSeekSortLen[i]))
+         ++fReadAheadHits;
+      else
+         missing.push_back(i);
+   }
+   AccountReadAhead();
+
+   if (missing.empty())
+      return 0;
+   if ((Int_t)missing.size() == fNseek)
+      return fFile->ReadBuffers(fBuffer, fPos, fLen, fNb);
+
+   std::vector<Long64_t> pos;
+   std::vector<Int_t> len;
+   Long64_t ntot = 0;
+   for (auto i : missing) {
+      pos.push_back(fSeekSort[i]);
+      len.push_back(fSeekSortLen[i]);
+      ntot += fSeekSortLen[i];
+   }
+   std::vector<char> missed(ntot);
+   if (fFile->ReadBuffers(missed.data(), pos.data(), len.data(), (Int_t)missing.size()))
+      return 1;
+   ntot = 0;
+   for (auto i : missing) {
+      memcpy(fBuffer + fSeekPos[i], missed.data() + ntot, fSeekSortLen[i]);
+      ntot += fSeekSortLen[i];
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading in the background the clusters following the content of the cache,
+/// up to the number of clusters and the memory cap given to SetReadAhead.
+/// Called at the end of FillBuffer; the clusters that were consumed or skipped are released.
+
+void TTreeCache::ReadAhead()
+{
+   if (fReadAheadClusters <= 0 || fNbranches <= 0 || !fFile || fEnablePrefetching || fAsyncReading || fReverseRead)
+      return;
+   if (fReadAhead && fReadAhead->GetFile() != fFile)
+      ClearReadAhead();
+   if (!fReadAhead) {
+      fReadAhead = ROOT::Internal::TTreeCacheReadAhead::Create(fFile);
+      if (!fReadAhead)
+         return;
+   }
+
+   fReadAhead->DropBefore(fEntryCurrent);
+   if (fReadAhead->GetStagedStart() > fEntryNext) {
+      // We jumped backward, the staged clusters are not the next ones
+      fReadAhead->Clear();
+      AccountReadAhead();
+   }
+
+   TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
+   const Long64_t entryMax = std::min(fEntryMax, tree->GetEntries());
+   const Long64_t maxBytes = GetReadAheadMaxBytes();
+   Long64_t start = std::max(fEntryNext, fReadAhead->GetStagedEnd());
+   while (start < entryMax && fReadAhead->GetNClusters(fEntryNext) < fReadAheadClusters) {
+      TTree::TClusterIterator clusterIter = tree->GetClusterIterator(start);
+      clusterIter();
+      const Long64_t end = std::min(clusterIter.GetNextEntry(), entryMax);
+
+      std::vector<ROOT::Internal::TTreeCacheReadAhead::Block_t> blocks;
+      Long64_t nbytes = 0;
+      for (Int_t i = 0; i < fNbranches; ++i) {
+         TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
+         if (b->GetDirectory() == nullptr || b->TestBit(TBranch::kDoNotProcess))
+            continue;
+         if (b->GetDirectory()->GetFile() != fFile)
+            continue;
+         Int_t nb = b->GetMaxBaskets();
+         Int_t *lbaskets = b->GetBasketBytes();
+         Long64_t *entries = b->GetBasketEntry();
+         if (!lbaskets || !entries)
+            continue;
+         Int_t blistsize = b->GetListOfBaskets()->GetSize();
+         auto first = TMath::BinarySearch(b->GetWriteBasket() + 1, entries, start);
+         for (Int_t j = first < 0 ? 0 : first; j < nb && entries[j] < end; ++j) {
+            // Baskets in memory or already registered in the cache
+            if ((j < blistsize && b->GetListOfBaskets()->UncheckedAt(j)) || b->fCacheInfo.IsInCache(j))
+               continue;
+            Long64_t pos = b->GetBasketSeek(j);
+            Int_t len = lbaskets[j];
+            // FillBuffer does not cache the baskets larger than the cache
+            if (pos <= 0 || len <= 0 || len > fBufferSizeMin)
+               continue;
+            blocks.emplace_back(pos, len);
+            nbytes += len;
+         }
+      }
+      if (fReadAhead->GetBytes() + nbytes > maxBytes)
+         break;
+      fReadAhead->Submit(start, end, std::move(blocks));
+      start = end;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the reads done in the background to the statistics of the file.
+
+void TTreeCache::AccountReadAhead()
+{
+   Long64_t bytes = 0;
+   Int_t calls = 0;
+   fReadAhead->TakeStatistics(bytes, calls);
+   TFile *file = fReadAhead->GetFile();
+   if (file && file == fFile) {
+      file->fBytesRead += bytes;
+      file->fReadCalls += calls;
+   }
+   TFile::fgBytesRead += bytes;
+   TFile::fgReadCalls += calls;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the background reads and release the clusters read ahead.
+
+void TTreeCache::ClearReadAhead()
+{
+   if (!fReadAhead)
+      return;
+   fReadAhead->Clear();
+   AccountReadAhead();
+   fReadAhead.reset();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Used to read a chunk from a block previously fetched. It will call FillBuffer
 /// even if the cache lookup succeeds, because it will try to prefetch the next block
@@ -2130,6 +2334,7 @@ void TTreeCache::SetFile(TFile *file, TFile::ECacheAction action)
    // The infinite recursion is 'broken' by the fact that
    // TFile::SetCacheRead remove the entry from fCacheReadMap _before_
    // calling SetFile (and also by setting fFile to zero before the calling).
+   ClearReadAhead();
    if (fFile) {
       TFile *prevFile = fFile;
       fFile = nullptr;
@@ -2162,6 +2367,33 @@ void TTreeCache::SetLearnPrefill(TTreeCache::EPrefillType type /* = kNoPrefill *
    fPrefillType = type;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the baskets of the nclusters clusters following the content of the cache in the
+/// background, while the current cluster is processed, see \ref readahead.
+/// The clusters read ahead use at most maxbytes bytes of memory, by default 2*nclusters
+/// times the size of the cache. A cluster that does not fit is read when the cache is filled.
+/// nclusters = 0 disables the read-ahead.
+/// The default number of clusters can be set with TTreeCache.ReadAhead or the environment
+/// variable ROOT_TTREECACHE_READAHEAD.
+
+void TTreeCache::SetReadAhead(Int_t nclusters, Long64_t maxbytes /* = -1 */)
+{
+   fReadAheadClusters = nclusters > 0 ? nclusters : 0;
+   fReadAheadMaxBytes = maxbytes;
+   if (fReadAheadClusters == 0)
+      ClearReadAhead();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the memory cap of the clusters read in the background, see SetReadAhead.
+
+Long64_t TTreeCache::GetReadAheadMaxBytes() const
+{
+   if (fReadAheadMaxBytes >= 0)
+      return fReadAheadMaxBytes;
+   return 2LL * fReadAheadClusters * GetBufferSize();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The name should be enough to explain the method.
 /// The only additional comments is that the cache is cleaned before
@@ -2315,3 +2547,77 @@ void TTreeCache::LearnPrefill()
 
    fLearnPrefilling = false;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save the names of the branches in the cache to a text file, so that a later job
+/// reading the same tree can skip the learning phase with LoadLearnedBranches.
+/// Each line holds the name of a branch and its compressed size in the current file,
+/// the branches with the largest volume first.
+/// Returns the number of branches saved, or -1 if the file could not be written.
+
+Int_t TTreeCache::SaveLearnedBranches(const char *filename) const
+{
+   if (fIsLearning)
+      Warning("SaveLearnedBranches", "The learning phase is not over, some branches may be missing");
+
+   std::ofstream out(filename);
+   if (!out) {
+      Error("SaveLearnedBranches", "Cannot open %s for writing", filename);
+      return -1;
+   }
+
+   std::vector<std::pair<Long64_t, std::string>> branches;
+   TIter next(fBrNames);
+   while (auto name = static_cast<TObjString *>(next())) {
+      TBranch *b = fTree ? fTree->GetBranch(name->GetName()) : nullptr;
+      branches.emplace_back(b ? b->GetZipBytes() : 0, name->GetName());
+   }
+   std::stable_sort(branches.begin(), branches.end(),
+                    [](const auto &a, const auto &b) { return a.first > b.first; });
+
+   out << "# Branches read through the TTreeCache of tree " << (fTree ? fTree->GetName() : "") << "\n";
+   out << "# name\tcompressed bytes\n";
+   for (const auto &b : branches)
+      out << b.second << '\t' << b.first << '\n';
+   if (!out) {
+      Error("SaveLearnedBranches", "Error writing %s", filename);
+      return -1;
+   }
+   return branches.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the branches listed in a file written by SaveLearnedBranches to the cache and
+/// stop the learning phase, so that the first cluster is already prefetched with all
+/// the branches used by the previous job.
+/// The branches that are not in the tree are skipped with a warning. The learning phase
+/// is kept if no branch is added.
+/// Returns the number of branches added, or -1 if the file could not be read.
+
+Int_t TTreeCache::LoadLearnedBranches(const char *filename)
+{
+   std::ifstream in(filename);
+   if (!in) {
+      Error("LoadLearnedBranches", "Cannot open %s", filename);
+      return -1;
+   }
+
+   Int_t nbranches = 0;
+   std::string line;
+   while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+         continue;
+      const std::string name = line.substr(0, line.rfind('\t'));
+      TBranch *b = fTree->GetBranch(name.c_str());
+      if (!b) {
+         Warning("LoadLearnedBranches", "Branch %s is not in tree %s", name.c_str(), fTree->GetName());
+         continue;
+      }
+      if (AddBranch(b) == 0)
+         ++nbranches;
+   }
+
+   if (nbranches > 0)
+      StopLearningPhase();
+   return nbranches;
+}
@@ -0,0 +1,240 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TTreeCacheReadAhead.h"
+
+#include "ROOT/RRawFile.hxx"
+#include "TError.h"
+#include "TFile.h"
+#include "TUrl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+namespace ROOT {
+namespace Internal {
+
+TTreeCacheReadAhead::TTreeCacheReadAhead(TFile *file, std::unique_ptr<RRawFile> rawFile)
+   : fFile(file), fRawFile(std::move(rawFile))
+{
+   fThreadIo = std::thread(&TTreeCacheReadAhead::ExecReads, this);
+}
+
+TTreeCacheReadAhead::~TTreeCacheReadAhead()
+{
+   Clear();
+   {
+      std::lock_guard<std::mutex> lock(fLockReadQueue);
+      fReadQueue.emplace_back(RReadItem());
+   }
+   fCvHasReadWork.notify_one();
+   fThreadIo.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a read-ahead stage for the file, or nullptr if the file cannot be opened a second time for reading:
+/// files being written, files in archives and TFile implementations that have no RRawFile counterpart. Remote files
+/// are opened again through RRawFile::Create(), i.e. with RRawFileDavix or RRawFileNetXNG.
+
+std::unique_ptr<TTreeCacheReadAhead> TTreeCacheReadAhead::Create(TFile *file)
+{
+   if (!file || file->IsWritable() || file->GetArchive() || file->GetArchiveOffset() != 0)
+      return nullptr;
+
+   std::string url;
+   if (file->IsA() == TFile::Class())
+      url = file->GetName();
+   else if (file->InheritsFrom("TDavixFile") || file->InheritsFrom("TNetXNGFile"))
+      url = file->GetEndpointUrl()->GetUrl();
+   else
+      return nullptr;
+
+   RRawFile::ROptions options;
+   // The requests are large and never repeated
+   options.fBlockSize = 0;
+   try {
+      return std::unique_ptr<TTreeCacheReadAhead>(new TTreeCacheReadAhead(file, RRawFile::Create(url, options)));
+   } catch (const std::exception &e) {
+      ::Warning("TTreeCacheReadAhead::Create", "read-ahead disabled for %s: %s", file->GetName(), e.what());
+   }
+   return nullptr;
+}
+
+Int_t TTreeCacheReadAhead::GetNClusters(Long64_t entry) const
+{
+   return std::count_if(fClusters.begin(), fClusters.end(),
+                        [entry](const std::unique_ptr<RStagedCluster> &c) { return c->fEntryStart >= entry; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading the given baskets of the cluster [entryStart, entryEnd[ in the background.
+/// The clusters must be submitted in increasing entry order.
+
+void TTreeCacheReadAhead::Submit(Long64_t entryStart, Long64_t entryEnd, std::vector<Block_t> &&blocks)
+{
+   auto cluster = std::make_unique<RStagedCluster>();
+   cluster->fEntryStart = entryStart;
+   cluster->fEntryEnd = entryEnd;
+   if (blocks.empty()) {
+      // All the baskets are in memory, there is nothing to read
+      cluster->fWaited = true;
+      cluster->fOk = true;
+      fClusters.emplace_back(std::move(cluster));
+      return;
+   }
+
+   // Merge the adjacent and the overlapping baskets into single requests
+   std::sort(blocks.begin(), blocks.end());
+   for (const auto &block : blocks) {
+      if (!cluster->fOffsets.empty() && block.first <= cluster->fOffsets.back() + cluster->fSizes.back()) {
+         auto &size = cluster->fSizes.back();
+         size = std::max(size, block.first + block.second - cluster->fOffsets.back());
+         continue;
+      }
+      cluster->fOffsets.push_back(block.first);
+      cluster->fSizes.push_back(block.second);
+   }
+   for (auto size : cluster->fSizes) {
+      cluster->fBufferOffsets.push_back(cluster->fSize);
+      cluster->fSize += size;
+   }
+   cluster->fBuffer.reset(new char[cluster->fSize]);
+
+   RReadItem item;
+   item.fCluster = cluster.get();
+   cluster->fResult = item.fPromise.get_future();
+   {
+      std::lock_guard<std::mutex> lock(fLockReadQueue);
+      fReadQueue.emplace_back(std::move(item));
+   }
+   fCvHasReadWork.notify_one();
+   fBytes += cluster->fSize;
+   fClusters.emplace_back(std::move(cluster));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The main loop of the I/O thread: read the submitted clusters in order until the stop item arrives.
+
+void TTreeCacheReadAhead::ExecReads()
+{
+   while (true) {
+      RReadItem item;
+      {
+         std::unique_lock<std::mutex> lock(fLockReadQueue);
+         fCvHasReadWork.wait(lock, [this] { return !fReadQueue.empty(); });
+         item = std::move(fReadQueue.front());
+         fReadQueue.pop_front();
+      }
+      if (!item.fCluster)
+         return;
+      item.fPromise.set_value(Read(*item.fCluster));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by the I/O thread: read the requests of the cluster with a vector read, respecting the limits of the
+/// transport.
+
+bool TTreeCacheReadAhead::Read(RStagedCluster &cluster)
+{
+   try {
+      const auto limits = fRawFile->GetReadVLimits();
+      std::vector<RRawFile::RIOVec> ioVec;
+      for (std::size_t i = 0; i < cluster.fOffsets.size(); ++i) {
+         for (Long64_t done = 0; done < cluster.fSizes[i];) {
+            RRawFile::RIOVec req;
+            req.fBuffer = cluster.fBuffer.get() + cluster.fBufferOffsets[i] + done;
+            req.fOffset = cluster.fOffsets[i] + done;
+            req.fSize = std::min<std::size_t>(cluster.fSizes[i] - done, limits.fMaxSingleSize);
+            done += req.fSize;
+            ioVec.emplace_back(req);
+         }
+      }
+      for (std::size_t first = 0, nReq = 0; first < ioVec.size(); first += nReq) {
+         nReq = std::min(ioVec.size() - first, limits.fMaxReqs);
+         fRawFile->ReadV(&ioVec[first], nReq);
+         for (std::size_t i = first; i < first + nReq; ++i) {
+            if (ioVec[i].fOutBytes != ioVec[i].fSize)
+               return false;
+         }
+      }
+   } catch (const std::exception &) {
+      return false;
+   }
+   return true;
+}
+
+void TTreeCacheReadAhead::Wait(RStagedCluster &cluster)
+{
+   if (cluster.fWaited)
+      return;
+   cluster.fOk = cluster.fResult.get();
+   cluster.fWaited = true;
+   fBytesRead += cluster.fSize;
+   ++fReadCalls;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the basket at [pos, pos+len[ into buf if it was staged, waiting for its background read if needed.
+/// Return false if the basket was not staged or could not be read.
+
+bool TTreeCacheReadAhead::Fetch(char *buf, Long64_t pos, Int_t len)
+{
+   for (auto &cluster : fClusters) {
+      // The last request starting at or before pos
+      auto it = std::upper_bound(cluster->fOffsets.begin(), cluster->fOffsets.end(), pos);
+      if (it == cluster->fOffsets.begin())
+         continue;
+      const auto i = std::distance(cluster->fOffsets.begin(), it) - 1;
+      if (pos + len > cluster->fOffsets[i] + cluster->fSizes[i])
+         continue;
+      Wait(*cluster);
+      if (!cluster->fOk)
+         return false;
+      std::memcpy(buf, cluster->fBuffer.get() + cluster->fBufferOffsets[i] + (pos - cluster->fOffsets[i]), len);
+      return true;
+   }
+   return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the clusters that end before `entry`, i.e. that were consumed or skipped.
+
+void TTreeCacheReadAhead::DropBefore(Long64_t entry)
+{
+   while (!fClusters.empty() && fClusters.front()->fEntryEnd <= entry) {
+      Wait(*fClusters.front());
+      fBytes -= fClusters.front()->fSize;
+      fClusters.pop_front();
+   }
+}
+
+void TTreeCacheReadAhead::Clear()
+{
+   for (auto &cluster : fClusters)
+      Wait(*cluster);
+   fClusters.clear();
+   fBytes = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Report the bytes and the read calls of the finished background reads, to be accounted to the TFile.
+
+void TTreeCacheReadAhead::TakeStatistics(Long64_t &bytesRead, Int_t &readCalls)
+{
+   bytesRead = fBytesRead;
+   readCalls = fReadCalls;
+   fBytesRead = 0;
+   fReadCalls = 0;
+}
+
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,110 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeCacheReadAhead
+#define ROOT_TTreeCacheReadAhead
+
+#include "RtypesCore.h"
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Internal {
+
+class RRawFile;
+
+/** \class ROOT::Internal::TTreeCacheReadAhead
+ The read-ahead stage of a TTreeCache, see TTreeCache::SetReadAhead().
+
+ The baskets of the clusters following the one in the cache are read in the background, through a RRawFile opened
+ on the same file since TFile is not thread-safe, while the current cluster is processed. When the cache is filled
+ for one of these clusters, the baskets are copied from the staged buffers instead of being read from the file.
+ All member functions are called by the thread that owns the cache. The background reads are done one after the
+ other by a single I/O thread, which only touches the staged cluster it reads.
+*/
+
+class TTreeCacheReadAhead {
+public:
+   /// Position and length of a basket in the file
+   using Block_t = std::pair<Long64_t, Int_t>;
+
+private:
+   struct RStagedCluster {
+      Long64_t fEntryStart = 0;
+      Long64_t fEntryEnd = 0;
+      std::vector<Long64_t> fOffsets;       ///< File offsets of the (merged) requests, sorted
+      std::vector<Long64_t> fSizes;         ///< Size of the requests
+      std::vector<Long64_t> fBufferOffsets; ///< Position of the requests in fBuffer
+      std::unique_ptr<char[]> fBuffer;
+      Long64_t fSize = 0;                   ///< Total size of the requests
+      std::future<bool> fResult;            ///< Becomes ready when the background read is done
+      bool fWaited = false;
+      bool fOk = false;
+   };
+
+   /// A cluster to be read by the I/O thread; an item without cluster stops the thread
+   struct RReadItem {
+      RStagedCluster *fCluster = nullptr;
+      std::promise<bool> fPromise;
+   };
+
+   TFile *fFile = nullptr;                  ///< The file whose baskets are read ahead
+   std::unique_ptr<RRawFile> fRawFile;      ///< Second handle on the file, only used by fThreadIo
+   std::mutex fLockReadQueue;               ///< Protects fReadQueue
+   std::condition_variable fCvHasReadWork;  ///< Signals a non-empty fReadQueue
+   std::deque<RReadItem> fReadQueue;        ///< The clusters to be read by fThreadIo, in order
+   std::thread fThreadIo;                   ///< Performs the background reads
+   std::deque<std::unique_ptr<RStagedCluster>> fClusters; ///< Staged clusters ordered by entry range
+   Long64_t fBytes = 0;                     ///< Sum of the sizes of the staged clusters
+   Long64_t fBytesRead = 0;                 ///< Bytes read in the background, not yet reported by TakeStatistics()
+   Int_t fReadCalls = 0;                    ///< Vector reads done in the background, not yet reported
+
+   TTreeCacheReadAhead(TFile *file, std::unique_ptr<RRawFile> rawFile);
+
+   void ExecReads();
+   bool Read(RStagedCluster &cluster);
+   void Wait(RStagedCluster &cluster);
+
+public:
+   static std::unique_ptr<TTreeCacheReadAhead> Create(TFile *file);
+   ~TTreeCacheReadAhead();
+
+   TTreeCacheReadAhead(const TTreeCacheReadAhead &) = delete;
+   TTreeCacheReadAhead &operator=(const TTreeCacheReadAhead &) = delete;
+
+   TFile *GetFile() const { return fFile; }
+   Long64_t GetBytes() const { return fBytes; }
+   /// Number of staged clusters that start at or after `entry`
+   Int_t GetNClusters(Long64_t entry) const;
+   /// Start of the entry range of the first staged cluster, or -1
+   Long64_t GetStagedStart() const { return fClusters.empty() ? -1 : fClusters.front()->fEntryStart; }
+   /// End of the entry range of the last staged cluster, or -1
+   Long64_t GetStagedEnd() const { return fClusters.empty() ? -1 : fClusters.back()->fEntryEnd; }
+
+   void Submit(Long64_t entryStart, Long64_t entryEnd, std::vector<Block_t> &&blocks);
+   bool Fetch(char *buf, Long64_t pos, Int_t len);
+   void DropBefore(Long64_t entry);
+   void Clear();
+   void TakeStatistics(Long64_t &bytesRead, Int_t &readCalls);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
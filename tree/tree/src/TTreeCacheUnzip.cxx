@@ -346,6 +346,9 @@ bool TTreeCacheUnzip::FillBuffer()
    ResetCache();
    fIsLearning = false;
 
+   // Read the next clusters while the baskets of this one are unzipped
+   ReadAhead();
+
    return true;
 }
 
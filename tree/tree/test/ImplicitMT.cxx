@@ -6,6 +6,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -57,4 +59,69 @@ TEST(TChainImplicitMT, propagateToTTree)
    gSystem->Unlink(fname1);
 }
 
+TEST(TTreeImplicitMT, backgroundCompression)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "backgroundCompressionMT.root";
+   const Long64_t nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetBackgroundCompression();
+      EXPECT_TRUE(t.GetBackgroundCompression());
+      Long64_t i = 0;
+      double d = 0.;
+      std::vector<int> v;
+      t.Branch("i", &i, 1000);
+      t.Branch("d", &d, 1000);
+      t.Branch("v", &v, 1000);
+      auto branchD = t.GetBranch("d");
+      Int_t nHandedOver = 0;
+      for (; i < nEntries; ++i) {
+         d = 0.5 * i;
+         v.assign(i % 5, int(i));
+         const auto writeBasket = branchD->GetWriteBasket();
+         t.Fill();
+         if (branchD->GetWriteBasket() == writeBasket || ++nHandedOver != 20)
+            continue;
+
+         // The full basket was just handed to the compressor and is not written until the next one is full
+         const auto inFlight = branchD->GetWriteBasket() - 1;
+         EXPECT_EQ(branchD->GetBasketSeek(inFlight), 0);
+         // Grow the transient buffer of the branch: the next baskets are larger
+         t.SetBasketSize("*", 4000);
+         // Read an earlier basket, which uses the transient buffer of the branch
+         EXPECT_GT(branchD->GetEntry(0), 0);
+         EXPECT_EQ(d, 0.);
+         EXPECT_EQ(branchD->GetBasketSeek(inFlight), 0);
+         // Reading the basket being compressed waits for it
+         EXPECT_GT(branchD->GetEntry(i), 0);
+         EXPECT_EQ(d, 0.5 * i);
+         EXPECT_NE(branchD->GetBasketSeek(inFlight), 0);
+      }
+      EXPECT_EQ(nHandedOver, branchD->GetWriteBasket());
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   EXPECT_EQ(t->GetEntries(), nEntries);
+   EXPECT_GT(t->GetBranch("i")->GetWriteBasket(), 10);
+   Long64_t i = -1;
+   double d = 0.;
+   std::vector<int> *v = nullptr;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("d", &d);
+   t->SetBranchAddress("v", &v);
+   for (Long64_t entry = 0; entry < nEntries; ++entry) {
+      t->GetEntry(entry);
+      ASSERT_EQ(i, entry);
+      ASSERT_EQ(d, 0.5 * entry);
+      ASSERT_EQ(v->size(), std::size_t(entry % 5));
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
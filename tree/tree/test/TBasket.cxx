@@ -411,3 +411,78 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<bool *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, true);
 }
+
+// Baskets compressed in several blocks are decompressed on demand: reading an entry
+// only decompresses the blocks holding it.
+TEST(TBasket, TestZipBlocks)
+{
+   std::vector<char> memBuffer;
+   const Int_t nEntries = 10000;
+   {
+      TMemFile f("tbasket_zipblocks.root", "CREATE");
+      TTree t1("t1", "Tree with baskets compressed in blocks.");
+      t1.SetZipBlockSize(1000);
+      ROOT::TIOFeatures settings;
+      settings.Set(ROOT::Experimental::EIOFeatures::kGenerateOffsetMap);
+      t1.SetIOFeatures(settings);
+      Int_t idx;
+      Int_t elem;
+      Int_t sample[10];
+      std::vector<float> vec;
+      t1.Branch("idx", &idx, "idx/I", 32000);
+      t1.Branch("elem", &elem, "elem/I", 32000);
+      t1.Branch("sample", &sample, "sample[elem]/I", 32000);
+      t1.Branch("vec", &vec, 32000);
+      for (idx = 0; idx < nEntries; idx++) {
+         elem = idx % 9;
+         for (Int_t i = 0; i < 10; i++)
+            sample[i] = idx + i;
+         vec.assign(idx % 7, 0.5f * idx);
+         t1.Fill();
+      }
+      t1.Write();
+      f.Close();
+      memBuffer.resize(f.GetSize());
+      f.CopyTo(&memBuffer[0], f.GetSize());
+   }
+
+   TMemFile f2("tbasket_zipblocks.root", &memBuffer[0], memBuffer.size(), "READ");
+   TTree *saved_t1 = nullptr;
+   f2.GetObject("t1", saved_t1);
+   ASSERT_NE(saved_t1, nullptr);
+
+   Int_t idx = -1;
+   Int_t elem = -1;
+   Int_t sample[10];
+   std::vector<float> *vec = nullptr;
+   saved_t1->SetBranchAddress("idx", &idx);
+   saved_t1->SetBranchAddress("elem", &elem);
+   saved_t1->SetBranchAddress("sample", &sample);
+   saved_t1->SetBranchAddress("vec", &vec);
+
+   // Random access: the basket is only partially decompressed
+   const Long64_t entry = 1234;
+   EXPECT_GT(saved_t1->GetEntry(entry), 0);
+   EXPECT_EQ(idx, entry);
+   EXPECT_EQ(elem, entry % 9);
+   for (Int_t i = 0; i < elem; i++)
+      EXPECT_EQ(sample[i], entry + i);
+   ASSERT_NE(vec, nullptr);
+   EXPECT_EQ(vec->size(), std::size_t(entry % 7));
+   TBranch *br = saved_t1->GetBranch("idx");
+   TBasket *basket = br->GetBasket(br->GetReadBasket());
+   ASSERT_NE(basket, nullptr);
+   EXPECT_TRUE(basket->IsPartiallyDecompressed());
+
+   // Reading all the entries, in reverse order
+   for (Long64_t i = nEntries - 1; i >= 0; i--) {
+      saved_t1->GetEntry(i);
+      ASSERT_EQ(idx, i);
+      ASSERT_EQ(elem, i % 9);
+      for (Int_t j = 0; j < elem; j++)
+         ASSERT_EQ(sample[j], i + j);
+      ASSERT_EQ(vec->size(), std::size_t(i % 7));
+      for (auto v : *vec)
+         ASSERT_EQ(v, 0.5f * i);
+   }
+}
@@ -0,0 +1,88 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "ROOT/TestSupport.hxx"
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <string>
+
+class TTreeCacheLearningTest : public ::testing::Test {
+protected:
+   static constexpr const char *kFileName = "TTreeCacheLearningTest.root";
+   static constexpr const char *kBranchesFileName = "TTreeCacheLearningTest.branches";
+
+   static void SetUpTestCase()
+   {
+      TFile file(kFileName, "RECREATE");
+      TTree tree("tree", "tree");
+      tree.SetAutoFlush(1000);
+      int a = 0, b = 0, c = 0;
+      tree.Branch("a", &a);
+      tree.Branch("b", &b);
+      tree.Branch("c", &c);
+      for (int i = 0; i < 5000; ++i) {
+         a = i;
+         b = 2 * i;
+         c = 3 * i;
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   static void TearDownTestCase()
+   {
+      gSystem->Unlink(kFileName);
+      gSystem->Unlink(kBranchesFileName);
+   }
+};
+
+TEST_F(TTreeCacheLearningTest, SaveAndLoad)
+{
+   {
+      TFile file(kFileName);
+      auto tree = file.Get<TTree>("tree");
+      tree->SetCacheSize(100000);
+      int a = 0, c = 0;
+      tree->SetBranchAddress("a", &a);
+      tree->SetBranchAddress("c", &c);
+      for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+         tree->GetBranch("a")->GetEntry(i);
+         tree->GetBranch("c")->GetEntry(i);
+      }
+      auto cache = static_cast<TTreeCache *>(tree->GetReadCache(&file));
+      EXPECT_EQ(cache->SaveLearnedBranches(kBranchesFileName), 2);
+      tree->ResetBranchAddresses();
+   }
+
+   std::ifstream in(kBranchesFileName);
+   std::string line, names;
+   while (std::getline(in, line)) {
+      if (!line.empty() && line[0] != '#')
+         names += line.substr(0, line.find('\t'));
+   }
+   EXPECT_TRUE(names == "ac" || names == "ca");
+
+   TFile file(kFileName);
+   auto tree = file.Get<TTree>("tree");
+   tree->SetCacheSize(100000);
+   auto cache = static_cast<TTreeCache *>(tree->GetReadCache(&file));
+   EXPECT_EQ(cache->LoadLearnedBranches(kBranchesFileName), 2);
+   EXPECT_FALSE(cache->IsLearning());
+   EXPECT_EQ(cache->GetCachedBranches()->GetEntriesFast(), 2);
+
+   int a = 0, c = 0;
+   tree->SetBranchAddress("a", &a);
+   tree->SetBranchAddress("c", &c);
+   const auto readCalls = file.GetReadCalls();
+   tree->GetBranch("a")->GetEntry(0);
+   tree->GetBranch("c")->GetEntry(0);
+   // Both branches of the first cluster were read with a single read call
+   EXPECT_EQ(file.GetReadCalls() - readCalls, 1);
+   tree->ResetBranchAddresses();
+
+   ROOT_EXPECT_ERROR(EXPECT_EQ(cache->LoadLearnedBranches("TTreeCacheLearningTest.missing"), -1),
+                     "TTreeCache::LoadLearnedBranches", "Cannot open TTreeCacheLearningTest.missing");
+}
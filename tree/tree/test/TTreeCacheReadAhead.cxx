@@ -0,0 +1,113 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+class TTreeCacheReadAheadTest : public ::testing::Test {
+protected:
+   static constexpr int kNEntries = 20000;
+   static constexpr const char *kFileName = "TTreeCacheReadAheadTest.root";
+
+   static void SetUpTestCase()
+   {
+      TFile file(kFileName, "RECREATE");
+      TTree tree("tree", "tree");
+      tree.SetAutoFlush(1000);
+      int i = 0;
+      double x = 0.;
+      std::vector<float> v;
+      tree.Branch("i", &i);
+      tree.Branch("x", &x);
+      tree.Branch("v", &v);
+      for (int ev = 0; ev < kNEntries; ++ev) {
+         i = ev;
+         x = 0.5 * ev;
+         v.assign(ev % 5, ev);
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   static void TearDownTestCase() { gSystem->Unlink(kFileName); }
+
+   // Read the whole tree and check the values, return the number of bytes read from the file
+   // and the number of baskets served by the read-ahead in hits
+   static Long64_t ReadAll(Int_t nclusters, Long64_t maxbytes = -1, Long64_t *hits = nullptr)
+   {
+      TFile file(kFileName);
+      auto tree = file.Get<TTree>("tree");
+      tree->SetCacheSize(100000);
+      auto cache = dynamic_cast<TTreeCache *>(tree->GetReadCache(&file));
+      EXPECT_NE(cache, nullptr);
+      cache->SetReadAhead(nclusters, maxbytes);
+      EXPECT_EQ(cache->GetReadAheadClusters(), nclusters);
+
+      int i = 0;
+      double x = 0.;
+      std::vector<float> *v = nullptr;
+      tree->SetBranchAddress("i", &i);
+      tree->SetBranchAddress("x", &x);
+      tree->SetBranchAddress("v", &v);
+      for (Long64_t ev = 0; ev < tree->GetEntries(); ++ev) {
+         tree->GetEntry(ev);
+         EXPECT_EQ(i, ev);
+         EXPECT_DOUBLE_EQ(x, 0.5 * ev);
+         EXPECT_EQ(v->size(), std::size_t(ev % 5));
+         for (auto f : *v)
+            EXPECT_FLOAT_EQ(f, ev);
+      }
+      if (hits)
+         *hits = cache->GetReadAheadHits();
+      tree->ResetBranchAddresses();
+      delete v;
+      return file.GetBytesRead();
+   }
+};
+
+TEST_F(TTreeCacheReadAheadTest, SameContent)
+{
+   // The reads done in the background are accounted to the file
+   Long64_t hits = -1;
+   const auto bytes = ReadAll(0, -1, &hits);
+   EXPECT_GT(bytes, 0);
+   EXPECT_EQ(hits, 0);
+   // The baskets of the clusters after the first one are copied from the read-ahead:
+   // at most 19 clusters of 3 baskets
+   EXPECT_GT(ReadAll(1, -1, &hits), 0);
+   EXPECT_GT(hits, 0);
+   EXPECT_LE(hits, 19 * 3);
+   EXPECT_GT(ReadAll(2, -1, &hits), 0);
+   EXPECT_GT(hits, 0);
+   EXPECT_LE(hits, 19 * 3);
+}
+
+TEST_F(TTreeCacheReadAheadTest, MemoryCap)
+{
+   // No cluster fits, all the baskets are read when the cache is filled
+   Long64_t hits = -1;
+   EXPECT_EQ(ReadAll(2, 1, &hits), ReadAll(0));
+   EXPECT_EQ(hits, 0);
+}
+
+TEST_F(TTreeCacheReadAheadTest, SkipEntries)
+{
+   TFile file(kFileName);
+   auto tree = file.Get<TTree>("tree");
+   tree->SetCacheSize(100000);
+   static_cast<TTreeCache *>(tree->GetReadCache(&file))->SetReadAhead(2);
+
+   int i = 0;
+   tree->SetBranchAddress("i", &i);
+   tree->AddBranchToCache("i");
+   tree->StopCacheLearningPhase();
+   // Jump over the clusters read ahead, and back
+   for (Long64_t ev : {0, 500, 1500, 7000, 7500, 2500, 19999, 3000}) {
+      tree->GetEntry(ev);
+      EXPECT_EQ(i, ev);
+   }
+   tree->ResetBranchAddresses();
+}
@@ -91,6 +91,7 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static bool fgDynamicScheduling;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
@@ -111,6 +112,8 @@ public:
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetDynamicScheduling(bool dynamicScheduling);
+   static bool GetDynamicScheduling();
 };
 
 } // End of namespace ROOT
@@ -76,6 +76,8 @@ namespace Internal {
       virtual ~TVirtualCollectionReader();
       virtual size_t GetSize(Detail::TBranchProxy*) = 0;
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
+      /// Called when the TTreeReader switches to a new tree.
+      virtual void NotifyNewTree() {}
    };
 
 }
@@ -101,7 +101,7 @@ Base class of TTreeReaderValue.
       TTreeReaderValueBase& operator=(const TTreeReaderValueBase&);
 
       void RegisterWithTreeReader();
-      void NotifyNewTree(TTree* newTree);
+      virtual void NotifyNewTree(TTree* newTree);
 
       TBranch* SearchBranchWithCompositeName(TLeaf *&myleaf, TDictionary *&branchActualType, std::string &err);
       virtual void CreateProxy();
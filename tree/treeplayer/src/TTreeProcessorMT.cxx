@@ -24,8 +24,12 @@ of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTr
 objects.
 */
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <set>
 
+#include "TLeaf.h"
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
@@ -124,11 +128,46 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
+////////////////////////////////////////////////////////////////////////
+/// Return the compressed size of the baskets of the tree that start in each of the clusters, as an estimate of the
+/// cost of processing them. Cluster boundaries are global entry numbers, `offset` is the global number of the first
+/// entry of the tree.
+std::vector<Long64_t> GetClusterBytes(TTree &t, const std::vector<EntryRange> &clusters, Long64_t offset)
+{
+   std::vector<Long64_t> bytes(clusters.size(), 0ll);
+   std::set<TBranch *> branches;
+   TIter next(t.GetListOfLeaves());
+   while (auto *leaf = static_cast<TLeaf *>(next()))
+      branches.insert(leaf->GetBranch());
+
+   for (auto *branch : branches) {
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const Int_t *basketBytes = branch->GetBasketBytes();
+      for (Int_t i = 0; i < branch->GetWriteBasket(); ++i) {
+         const auto entry = basketEntry[i] + offset;
+         // find the last cluster that starts before or at the first entry of the basket
+         auto it = std::upper_bound(clusters.begin(), clusters.end(), entry,
+                                    [](Long64_t e, const EntryRange &c) { return e < c.first; });
+         if (it == clusters.begin())
+            continue;
+         --it;
+         if (entry < it->second)
+            bytes[std::distance(clusters.begin(), it)] += basketBytes[i];
+      }
+   }
+   // baskets can span several clusters: the clusters in which no basket starts are not free to process either
+   for (auto &b : bytes)
+      b = std::max(b, 1ll);
+   return bytes;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// If `clusterBytes` is not null, it is filled with the compressed size of each cluster (see GetClusterBytes).
 ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
                                        const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
-                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
+                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()},
+                                       std::vector<std::vector<Long64_t>> *clusterBytes = nullptr)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
@@ -185,6 +224,8 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
          if (currentEnd == range.second) // if the desired end is reached, stop reading further
             rangeEndReached = true;
       }
+      if (clusterBytes)
+         clusterBytes->emplace_back(GetClusterBytes(*t, entryRanges, offset));
       offset += entries; // consistently keep track of the total number of entries
       clustersPerFile.emplace_back(std::move(entryRanges));
       // Keep track of the entries, even if their corresponding tree is out of the range, e.g. entryRanges is empty
@@ -244,11 +285,51 @@ ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
+/// Hands out groups of consecutive clusters of a file to the tasks that process it, with "guided self-scheduling":
+/// each group costs a fraction of the work that remains, so groups are large at the beginning, which amortizes the
+/// setup of the tasks, and shrink down to single clusters at the end. Tasks take a new group as soon as they are done
+/// with the previous one, so that no straggler task is left running while the other workers are idle.
+class RClusterQueue {
+   const std::vector<EntryRange> &fClusters;
+   std::vector<Long64_t> fCumulativeCosts; ///< The cost of all the clusters before the i-th one
+   const unsigned int fNWorkers;
+   std::size_t fNext = 0;
+   std::mutex fMutex;
+
+public:
+   /// The cost of the clusters is the number of entries if `costs` is empty.
+   RClusterQueue(const std::vector<EntryRange> &clusters, const std::vector<Long64_t> &costs, unsigned int nWorkers)
+      : fClusters(clusters), fCumulativeCosts(clusters.size() + 1, 0ll), fNWorkers(std::max(nWorkers, 1u))
+   {
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         const auto cost = costs.empty() ? clusters[i].second - clusters[i].first : costs[i];
+         fCumulativeCosts[i + 1] = fCumulativeCosts[i] + cost;
+      }
+   }
+
+   /// Return false if all clusters were handed out already.
+   bool Pop(EntryRange &range)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fNext == fClusters.size())
+         return false;
+      // half of an even share of the remaining work: the last groups are small enough to balance the workers
+      const auto target = (fCumulativeCosts.back() - fCumulativeCosts[fNext]) / (2 * fNWorkers);
+      auto last = fNext;
+      while (last + 1 < fClusters.size() && fCumulativeCosts[last + 2] - fCumulativeCosts[fNext] <= target)
+         ++last;
+      range = EntryRange{fClusters[fNext].first, fClusters[last].second};
+      fNext = last + 1;
+      return true;
+   }
+};
+
 } // anonymous namespace
 
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+bool TTreeProcessorMT::fgDynamicScheduling = false;
 
 namespace Internal {
 
@@ -466,15 +547,42 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    const bool hasEntryList = fEntryList.GetN() > 0;
    const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalRange.first > 0 ||
                                           fGlobalRange.second != std::numeric_limits<Long64_t>::max();
+   // With dynamic scheduling clusters are not fused upfront, RClusterQueue groups them while processing
+   const bool dynamicScheduling = GetDynamicScheduling();
+   const unsigned int maxClustersPerFile =
+      dynamicScheduling ? std::numeric_limits<unsigned int>::max() : maxTasksPerFile;
+   std::vector<std::vector<Long64_t>> allClusterBytes;
    ClustersAndEntries allClusterAndEntries{};
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
-      if (hasEntryList)
+      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxClustersPerFile, fGlobalRange,
+                                          dynamicScheduling ? &allClusterBytes : nullptr);
+      if (hasEntryList) {
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
+         // clusters without selected entries were dropped: fall back to the number of entries as cost estimate
+         allClusterBytes.clear();
+      }
    }
 
+   // Process the clusters of a file, as they are or grouped dynamically
+   auto processClusters = [&](const std::vector<EntryRange> &clusters, const std::vector<Long64_t> &clusterBytes,
+                              const std::function<void(const EntryRange &)> &processCluster) {
+      if (!dynamicScheduling) {
+         fPool.Foreach(processCluster, clusters);
+         return;
+      }
+      RClusterQueue queue(clusters, clusterBytes, fPool.GetPoolSize());
+      const auto nTasks = std::min<std::size_t>(clusters.size(), maxTasksPerFile);
+      fPool.Foreach(
+         [&] {
+            EntryRange range;
+            while (queue.Pop(range))
+               processCluster(range);
+         },
+         nTasks);
+   };
+
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
       auto processCluster = [&](const EntryRange &c) {
@@ -482,7 +590,8 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
             fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
          func(*r);
       };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
+      processClusters(allClusters[fileIdx], allClusterBytes.empty() ? std::vector<Long64_t>{} : allClusterBytes[fileIdx],
+                      processCluster);
    };
 
    // Per-file processing that also retrieves cluster info for a file
@@ -490,14 +599,17 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      std::vector<std::vector<Long64_t>> clusterBytes;
+      const auto clustersAndEntries =
+         MakeClusters(treeNames, fileNames, maxClustersPerFile, {0, std::numeric_limits<Long64_t>::max()},
+                      dynamicScheduling ? &clusterBytes : nullptr);
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
       auto processCluster = [&](const EntryRange &c) {
          auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
          func(*r);
       };
-      fPool.Foreach(processCluster, clusters);
+      processClusters(clusters, clusterBytes.empty() ? std::vector<Long64_t>{} : clusterBytes[0], processCluster);
    };
 
    const auto firstNonEmpty =
@@ -542,3 +654,26 @@ void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Return whether the clusters of each file are grouped into tasks while processing, see SetDynamicScheduling().
+bool TTreeProcessorMT::GetDynamicScheduling()
+{
+   return fgDynamicScheduling;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Set whether the clusters of each file are grouped into tasks while processing.
+/// \param[in] dynamicScheduling Whether to group clusters dynamically.
+///
+/// By default, the clusters of each file are fused into a fixed number of tasks before processing starts (see
+/// SetTasksPerWorkerHint()). If the clusters have very different sizes, or the files are processed at different
+/// speeds, the last of these tasks can keep a few workers busy while all others are idle.
+/// With dynamic scheduling, tasks take groups of consecutive clusters from a shared queue instead, each group
+/// worth a fraction of the compressed bytes left in the file: groups shrink to single clusters towards the end of the
+/// file, which evens out the time at which the workers finish. The number of tasks per file is still capped by
+/// the tasks-per-worker hint.
+void TTreeProcessorMT::SetDynamicScheduling(bool dynamicScheduling)
+{
+   fgDynamicScheduling = dynamicScheduling;
+}
@@ -17,6 +17,7 @@
 #include "TBranchSTL.h"
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
 #include "TEnum.h"
 #include "TFriendElement.h"
@@ -31,6 +32,7 @@
 #include "TRegexp.h"
 
 #include <memory>
+#include <vector>
 
 // pin vtable
 ROOT::Internal::TVirtualCollectionReader::~TVirtualCollectionReader() {}
@@ -103,6 +105,81 @@ namespace {
       }
    };
 
+   // Reader interface for std::vector of numerical types, reading the collections of all the entries of a basket at
+   // once into contiguous memory with TBulkBranchRead::GetBulkCollectionEntries() instead of streaming them entry by
+   // entry. Branches that cannot be read this way are read through fFallback.
+   class TBulkSTLReader final: public TVirtualCollectionReader {
+   private:
+      std::unique_ptr<TVirtualCollectionReader> fFallback;
+      EDataType fType;
+      Int_t fElementSize;
+      TBufferFile fBuffer{TBuffer::kRead};
+      std::vector<Int_t> fOffsets;
+      TBranch *fBranch = nullptr;  // Branch of the entries in fBuffer
+      Long64_t fFirstEntry = -1;   // First entry in fBuffer
+      Long64_t fEndEntry = -1;     // One past the last entry in fBuffer
+      bool fUseFallback = false;   // Whether fBranch must be read through fFallback
+
+      // Return the index of the current entry in fOffsets, or -1 if it must be read through fFallback.
+      Long64_t GetIndex(ROOT::Detail::TBranchProxy* proxy) {
+         if (!proxy->IsInitialized() && !proxy->Setup())
+            return -1;
+         TBranch *branch = proxy->GetBranch();
+         const Long64_t entry = proxy->GetReadEntry();
+         if (branch != fBranch) {
+            NotifyNewTree();
+            fBranch = branch;
+            fUseFallback = !branch || branch->GetBulkRead().GetBulkCollectionType() != fType;
+         }
+         if (fUseFallback)
+            return -1;
+         if (entry < fFirstEntry || entry >= fEndEntry) {
+            fBuffer.SetBufferOffset(0);
+            const Int_t nEntries = fBranch->GetBulkRead().GetBulkCollectionEntries(entry, fBuffer, fOffsets);
+            if (nEntries <= 0) {
+               // e.g. a basket with displacements: stop trying for this branch
+               fUseFallback = true;
+               return -1;
+            }
+            fFirstEntry = entry;
+            fEndEntry = entry + nEntries;
+         }
+         fReadStatus = TTreeReaderValueBase::kReadSuccess;
+         return entry - fFirstEntry;
+      }
+
+   public:
+      TBulkSTLReader(std::unique_ptr<TVirtualCollectionReader> fallback, EDataType type, Int_t elementSize)
+         : fFallback(std::move(fallback)), fType(type), fElementSize(elementSize) {}
+
+      size_t GetSize(ROOT::Detail::TBranchProxy* proxy) override {
+         const Long64_t index = GetIndex(proxy);
+         if (index < 0) {
+            const size_t size = fFallback->GetSize(proxy);
+            fReadStatus = fFallback->fReadStatus;
+            return size;
+         }
+         return fOffsets[index + 1] - fOffsets[index];
+      }
+
+      void* At(ROOT::Detail::TBranchProxy* proxy, size_t idx) override {
+         const Long64_t index = GetIndex(proxy);
+         if (index < 0) {
+            void *address = fFallback->At(proxy, idx);
+            fReadStatus = fFallback->fReadStatus;
+            return address;
+         }
+         return fBuffer.Buffer() + (fOffsets[index] + idx) * fElementSize;
+      }
+
+      void NotifyNewTree() override {
+         // A branch of the new tree might reuse the address of the previous one.
+         fBranch = nullptr;
+         fFirstEntry = fEndEntry = -1;
+         fUseFallback = false;
+      }
+   };
+
    class TCollectionLessSTLReader final: public TVirtualCollectionReader {
    private:
       TVirtualCollectionProxy *fLocalCollection;
@@ -643,6 +720,16 @@ bool ROOT::Internal::TTreeReaderArrayBase::GetBranchAndLeaf(TBranch* &branch, TL
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// The TTreeReader has switched to a new TTree. Reset the state of the collection reader.
+
+void ROOT::Internal::TTreeReaderArrayBase::NotifyNewTree(TTree* newTree)
+{
+   TTreeReaderValueBase::NotifyNewTree(newTree);
+   if (fImpl)
+      fImpl->NotifyNewTree();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create the TVirtualCollectionReader object for our branch.
 
@@ -746,6 +833,14 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
             fImpl = std::make_unique<TCollectionLessSTLReader>(branchElement->GetClass()->GetCollectionProxy());
          }
       }
+
+      // std::vector of numerical types are read one basket at a time if they are stored with the requested type.
+      if (fImpl && fDict && fDict->IsA() == TDataType::Class()) {
+         auto dataType = static_cast<TDataType *>(fDict);
+         const auto type = static_cast<EDataType>(dataType->GetType());
+         if (type != kNoType_t && branchElement->GetBulkRead().GetBulkCollectionType() == type)
+            fImpl = std::make_unique<TBulkSTLReader>(std::move(fImpl), type, dataType->Size());
+      }
    } else if (branch->IsA() == TBranch::Class()) {
       auto topLeaf = branch->GetLeaf(branch->GetName());
       if (!topLeaf) {
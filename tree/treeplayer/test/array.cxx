@@ -1,5 +1,8 @@
 #include <ROOT/TSeq.hxx>
+#include "TBranch.h"
+#include "TChain.h"
 #include "TFile.h"
+#include "TInterpreter.h"
 #include "TTree.h"
 #include "TTreeReader.h"
 #include "TTreeReaderArray.h"
@@ -7,6 +10,8 @@
 
 #include "gtest/gtest.h"
 
+#include "data.h"
+
 TEST(TTreeReaderArray, Vector)
 {
    TTree *tree = new TTree("TTreeReaderArrayTree", "In-memory test tree");
@@ -29,6 +34,124 @@ TEST(TTreeReaderArray, Vector)
    EXPECT_FLOAT_EQ(17.f, vec[0]);
 }
 
+// Count the reads of a branch: TBranch::GetEntry() moves its read entry at every entry, while the bulk reader of
+// TTreeReaderArray moves it only once per basket.
+void CountBranchReads(TBranch *branch, Long64_t &lastReadEntry, int &nReads)
+{
+   if (branch->GetReadEntry() != lastReadEntry) {
+      lastReadEntry = branch->GetReadEntry();
+      ++nReads;
+   }
+}
+
+TEST(TTreeReaderArray, BulkVector)
+{
+   // std::vector branches of numerical types are read a basket at a time, also across the files of a chain
+   const char *fileNames[] = {"TTreeReaderArrayBulkVector0.root", "TTreeReaderArrayBulkVector1.root"};
+   const int nEntries[] = {1000, 300};
+   const char *branchNames[] = {"vecf", "vecl"};
+   int nBaskets[] = {0, 0};
+   for (int f = 0; f < 2; ++f) {
+      TFile file(fileNames[f], "RECREATE");
+      TTree tree("t", "t");
+      std::vector<float> vecf;
+      std::vector<Long64_t> vecl;
+      // small baskets, so that the entries are spread over several of them
+      tree.Branch("vecf", &vecf, 1000);
+      tree.Branch("vecl", &vecl, 1000);
+      for (int i = 0; i < nEntries[f]; ++i) {
+         vecf.assign(i % 7, f * 1000 + i);
+         vecl.assign(i % 3, -i);
+         tree.Fill();
+      }
+      tree.Write();
+      for (int b = 0; b < 2; ++b)
+         nBaskets[b] += tree.GetBranch(branchNames[b])->GetWriteBasket();
+   }
+
+   TChain chain("t");
+   for (auto fileName : fileNames)
+      chain.Add(fileName);
+   TTreeReader tr(&chain);
+   TTreeReaderArray<float> vecf(tr, "vecf");
+   TTreeReaderArray<Long64_t> vecl(tr, "vecl");
+   Long64_t lastReadEntry[] = {-1, -1};
+   int nReads[] = {0, 0};
+   int entry = 0;
+   while (tr.Next()) {
+      const int f = entry < nEntries[0] ? 0 : 1;
+      const int i = entry - f * nEntries[0];
+      ASSERT_EQ(vecf.GetSize(), std::size_t(i % 7));
+      for (auto x : vecf)
+         EXPECT_FLOAT_EQ(x, f * 1000 + i);
+      ASSERT_EQ(vecl.GetSize(), std::size_t(i % 3));
+      for (auto x : vecl)
+         EXPECT_EQ(x, -i);
+      for (int b = 0; b < 2; ++b)
+         CountBranchReads(chain.GetTree()->GetBranch(branchNames[b]), lastReadEntry[b], nReads[b]);
+      ++entry;
+   }
+   EXPECT_EQ(entry, nEntries[0] + nEntries[1]);
+
+   // The entries did not fall back to the per-entry readers
+   EXPECT_EQ(kFloat_t, chain.GetTree()->GetBranch("vecf")->GetBulkRead().GetBulkCollectionType());
+   EXPECT_EQ(kLong64_t, chain.GetTree()->GetBranch("vecl")->GetBulkRead().GetBulkCollectionType());
+   for (int b = 0; b < 2; ++b) {
+      EXPECT_GT(nBaskets[b], 2);
+      EXPECT_EQ(nReads[b], nBaskets[b]) << "for branch " << branchNames[b];
+   }
+
+   for (auto fileName : fileNames)
+      gSystem->Unlink(fileName);
+}
+
+TEST(TTreeReaderArray, BulkVectorMember)
+{
+   // std::vector data members of split objects are read a basket at a time as well
+   TInterpreter::EErrorCode error = TInterpreter::kNoError;
+   gInterpreter->ProcessLine("#include \"data.h\"", &error);
+   ASSERT_EQ(error, TInterpreter::kNoError);
+
+   const char *fileName = "TTreeReaderArrayBulkVectorMember.root";
+   const int nEntries = 500;
+   int nBaskets = 0;
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("t", "t");
+      Data data{};
+      tree.Branch("data", &data, 1000, 99);
+      for (int i = 0; i < nEntries; ++i) {
+         data.fVec.assign(i % 5, i);
+         tree.Fill();
+      }
+      tree.Write();
+      nBaskets = tree.GetBranch("fVec")->GetWriteBasket();
+   }
+
+   {
+      TFile file(fileName);
+      TTreeReader tr("t", &file);
+      TTreeReaderArray<double> vec(tr, "fVec");
+      Long64_t lastReadEntry = -1;
+      int nReads = 0;
+      int entry = 0;
+      while (tr.Next()) {
+         ASSERT_EQ(vec.GetSize(), std::size_t(entry % 5));
+         for (auto x : vec)
+            EXPECT_DOUBLE_EQ(x, entry);
+         CountBranchReads(tr.GetTree()->GetBranch("fVec"), lastReadEntry, nReads);
+         ++entry;
+      }
+      EXPECT_EQ(entry, nEntries);
+
+      EXPECT_EQ(kDouble_t, tr.GetTree()->GetBranch("fVec")->GetBulkRead().GetBulkCollectionType());
+      EXPECT_GT(nBaskets, 2);
+      EXPECT_EQ(nReads, nBaskets);
+   }
+
+   gSystem->Unlink(fileName);
+}
+
 TEST(TTreeReaderArray, MultiReaders)
 {
    // See https://root.cern/phpBB3/viewtopic.php?f=3&t=22790
@@ -365,6 +365,41 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, DynamicScheduling)
+{
+   const auto nEvents = 991;
+   const auto filename = "TreeProcessorMT_DynamicScheduling.root";
+   const auto treename = "t";
+   WriteFileManyClusters(nEvents, treename, filename);
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   auto get_ranges = [&m, &ranges](TTreeReader &t) {
+      std::lock_guard<std::mutex> l(m);
+      ranges.emplace_back(t.GetEntriesRange());
+   };
+
+   ROOT::TTreeProcessorMT::SetDynamicScheduling(true);
+   ROOT::EnableImplicitMT(4);
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(get_ranges);
+   ROOT::DisableImplicitMT();
+   ROOT::TTreeProcessorMT::SetDynamicScheduling(false);
+
+   // the tasks run in any order: look at the ranges in the order of their entries
+   using R = std::pair<Long64_t, Long64_t>;
+   std::sort(ranges.begin(), ranges.end(), [](const R &r1, const R &r2) { return r1.first < r2.first; });
+
+   // all clusters are processed exactly once, grouped into fewer ranges than clusters...
+   CheckClusters(ranges, nEvents);
+   EXPECT_LT(ranges.size(), static_cast<std::size_t>(nEvents));
+   // ...that shrink towards the end of the file, down to single clusters
+   EXPECT_GT(ranges.front().second - ranges.front().first, 1ll);
+   EXPECT_EQ(ranges.back().second - ranges.back().first, 1ll);
+
+   gSystem->Unlink(filename);
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};